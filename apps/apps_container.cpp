@@ -2,6 +2,7 @@
 #include "apps_container_storage.h"
 #include "global_preferences.h"
 #include "exam_mode_configuration.h"
+#include "shared/reduced_expression_cache.h"
 #include <ion.h>
 #include <poincare/init.h>
 #include <poincare/exception_checkpoint.h>
@@ -431,7 +432,9 @@ void AppsContainer::examDeactivatingPopUpIsDismissed() {
 }
 
 void AppsContainer::storageDidChangeForRecord(const Ion::Storage::Record record) {
-  if (s_activeApp) {
+  /* Filling the cache of reduced expressions does not outdate any memoized
+   * model, and happens while reducing one of them. */
+  if (s_activeApp && !Shared::ReducedExpressionCache::IsCacheRecord(record)) {
     s_activeApp->snapshot()->storageDidChangeForRecord(record);
   }
 }
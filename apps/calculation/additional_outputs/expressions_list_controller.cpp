@@ -7,9 +7,10 @@ namespace Calculation {
 
 /* Expressions list controller */
 
-ExpressionsListController::ExpressionsListController(EditExpressionController * editExpressionController) :
+ExpressionsListController::ExpressionsListController(EditExpressionController * editExpressionController, ExpressionsListModel * model) :
   ListController(editExpressionController),
-  m_cells{}
+  m_cells{},
+  m_model(model)
 {
   for (int i = 0; i < k_maxNumberOfRows; i++) {
     m_cells[i].setParentResponder(m_listController.selectableTableView());
@@ -32,9 +33,8 @@ void ExpressionsListController::viewDidDisappear() {
     /* By reseting m_layouts, numberOfRow will go down to 0, and the highlighted
      * cells won't be unselected. Therefore we unselect them here. */
     m_cells[i].setHighlighted(false);
-    m_layouts[i] = Layout();
   }
-  m_expression = Expression();
+  setExpression(Expression());
 }
 
 HighlightCell * ExpressionsListController::reusableCell(int index, int type) {
@@ -42,9 +42,7 @@ HighlightCell * ExpressionsListController::reusableCell(int index, int type) {
 }
 
 KDCoordinate ExpressionsListController::rowHeight(int j) {
-  Layout l = layoutAtIndex(j);
-  assert(!l.isUninitialized());
-  return l.layoutSize().height() + 2 * Metric::CommonSmallMargin + Metric::CellSeparatorThickness;
+  return layoutAtIndex(j).layoutSize().height() + 2 * Metric::CommonSmallMargin + Metric::CellSeparatorThickness;
 }
 
 void ExpressionsListController::willDisplayCellForIndex(HighlightCell * cell, int index) {
@@ -53,35 +51,24 @@ void ExpressionsListController::willDisplayCellForIndex(HighlightCell * cell, in
    * here, when setting cell's layout. */
   ExpressionTableCellWithPointer * myCell = static_cast<ExpressionTableCellWithPointer *>(cell);
   myCell->setLayout(layoutAtIndex(index));
-  myCell->setAccessoryMessage(messageAtIndex(index));
+  myCell->setAccessoryMessage(m_model->messageAtIndex(index));
   myCell->reloadScroll();
 }
 
 int ExpressionsListController::numberOfRows() const {
-  int nbOfRows = 0;
-  for (size_t i = 0; i < k_maxNumberOfRows; i++) {
-    if (!m_layouts[i].isUninitialized()) {
-      nbOfRows++;
-    }
-  }
-  return nbOfRows;
+  return m_model->numberOfRows(App::app()->localContext());
 }
 
 void ExpressionsListController::setExpression(Poincare::Expression e) {
-  // Reinitialize memoization
-  for (int i = 0; i < k_maxNumberOfRows; i++) {
-    m_layouts[i] = Layout();
-  }
-  m_expression = e;
+  m_model->setExpression(e);
 }
 
-Poincare::Layout ExpressionsListController::layoutAtIndex(int index) {
-  assert(!m_layouts[index].isUninitialized());
-  return m_layouts[index];
+Poincare::Layout ExpressionsListController::layoutAtIndex(int index) const {
+  return m_model->layoutAtIndex(index, App::app()->localContext());
 }
 
 int ExpressionsListController::textAtIndex(char * buffer, size_t bufferSize, int index) {
-  return m_layouts[index].serializeParsedExpression(buffer, bufferSize, App::app()->localContext());
+  return layoutAtIndex(index).serializeParsedExpression(buffer, bufferSize, App::app()->localContext());
 }
 
 }
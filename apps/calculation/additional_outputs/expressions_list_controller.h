@@ -5,12 +5,13 @@
 #include <poincare/expression.h>
 #include <apps/i18n.h>
 #include "list_controller.h"
+#include "expressions_list_model.h"
 
 namespace Calculation {
 
 class ExpressionsListController : public ListController {
 public:
-  ExpressionsListController(EditExpressionController * editExpressionController);
+  ExpressionsListController(EditExpressionController * editExpressionController, ExpressionsListModel * model);
 
   // Responder
   void viewDidDisappear() override;
@@ -28,16 +29,13 @@ public:
   void setExpression(Poincare::Expression e) override;
 
 protected:
-  constexpr static int k_maxNumberOfRows = 5;
+  constexpr static int k_maxNumberOfRows = ExpressionsListModel::k_maxNumberOfRows;
   int textAtIndex(char * buffer, size_t bufferSize, int index) override;
-  Poincare::Expression m_expression;
-  // Memoization of layouts
-  mutable Poincare::Layout m_layouts[k_maxNumberOfRows];
+  Poincare::Layout layoutAtIndex(int index) const;
 private:
-  Poincare::Layout layoutAtIndex(int index);
-  virtual I18n::Message messageAtIndex(int index) = 0;
   // Cells
   ExpressionTableCellWithPointer m_cells[k_maxNumberOfRows];
+  ExpressionsListModel * m_model;
 };
 
 }
@@ -0,0 +1,37 @@
+#include "expressions_list_model.h"
+#include <assert.h>
+
+using namespace Poincare;
+
+namespace Calculation {
+
+void ExpressionsListModel::setExpression(Expression e) {
+  // Reinitialize memoization
+  for (int i = 0; i < k_maxNumberOfRows; i++) {
+    m_layouts[i] = Layout();
+  }
+  m_numberOfRows = k_numberOfRowsNotComputed;
+  m_expression = e;
+}
+
+int ExpressionsListModel::numberOfRows(Context * context) const {
+  if (m_expression.isUninitialized()) {
+    return 0;
+  }
+  if (m_numberOfRows == k_numberOfRowsNotComputed) {
+    m_numberOfRows = computeNumberOfRows(context);
+    assert(m_numberOfRows >= 0 && m_numberOfRows <= k_maxNumberOfRows);
+  }
+  return m_numberOfRows;
+}
+
+Layout ExpressionsListModel::layoutAtIndex(int index, Context * context) const {
+  assert(index >= 0 && index < numberOfRows(context));
+  if (m_layouts[index].isUninitialized()) {
+    m_layouts[index] = computeLayoutAtIndex(index, context);
+    assert(!m_layouts[index].isUninitialized());
+  }
+  return m_layouts[index];
+}
+
+}
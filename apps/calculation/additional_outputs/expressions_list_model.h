@@ -0,0 +1,39 @@
+#ifndef CALCULATION_ADDITIONAL_OUTPUTS_EXPRESSIONS_LIST_MODEL_H
+#define CALCULATION_ADDITIONAL_OUTPUTS_EXPRESSIONS_LIST_MODEL_H
+
+#include <poincare/context.h>
+#include <poincare/expression.h>
+#include <poincare/layout.h>
+#include <apps/i18n.h>
+
+namespace Calculation {
+
+class ExpressionsListModel {
+public:
+  constexpr static int k_maxNumberOfRows = 5;
+  ExpressionsListModel() : m_numberOfRows(k_numberOfRowsNotComputed) {}
+  /* Setting an uninitialized expression releases the expression and the
+   * memoized rows from the pool. */
+  virtual void setExpression(Poincare::Expression e);
+  int numberOfRows(Poincare::Context * context) const;
+  Poincare::Layout layoutAtIndex(int index, Poincare::Context * context) const;
+  virtual I18n::Message messageAtIndex(int index) const = 0;
+protected:
+  Poincare::Expression m_expression;
+  // Memoization of layouts
+  mutable Poincare::Layout m_layouts[k_maxNumberOfRows];
+private:
+  /* The number of rows and the layout of each row are computed from
+   * m_expression the first time they are needed, rather than when the
+   * expression is set. */
+  constexpr static int k_numberOfRowsNotComputed = -1;
+  /* computeNumberOfRows memoizes the layouts it had to build to tell whether
+   * their rows exist. computeLayoutAtIndex builds any other row. */
+  virtual int computeNumberOfRows(Poincare::Context * context) const = 0;
+  virtual Poincare::Layout computeLayoutAtIndex(int index, Poincare::Context * context) const = 0;
+  mutable int m_numberOfRows;
+};
+
+}
+
+#endif
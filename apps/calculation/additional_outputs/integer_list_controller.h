@@ -2,23 +2,19 @@
 #define CALCULATION_ADDITIONAL_OUTPUTS_INTEGER_LIST_CONTROLLER_H
 
 #include "expressions_list_controller.h"
+#include "integer_list_model.h"
 
 namespace Calculation {
 
 class IntegerListController : public ExpressionsListController {
 public:
   IntegerListController(EditExpressionController * editExpressionController) :
-    ExpressionsListController(editExpressionController) {}
-
-  void setExpression(Poincare::Expression e) override;
+    ExpressionsListController(editExpressionController, &m_model) {}
 
 private:
-  static constexpr int k_indexOfFactorExpression = 3;
-  I18n::Message messageAtIndex(int index) override;
+  IntegerListModel m_model;
 };
 
 }
 
 #endif
-
-
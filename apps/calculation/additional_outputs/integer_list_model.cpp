@@ -1,9 +1,7 @@
-#include "integer_list_controller.h"
+#include "integer_list_model.h"
 #include <poincare/based_integer.h>
 #include <poincare/integer.h>
-#include <poincare/empty_layout.h>
 #include <poincare/factor.h>
-#include "../app.h"
 #include "../../shared/poincare_helpers.h"
 
 using namespace Poincare;
@@ -23,23 +21,27 @@ Integer::Base baseAtIndex(int index) {
   }
 }
 
-void IntegerListController::setExpression(Poincare::Expression e) {
-  ExpressionsListController::setExpression(e);
+int IntegerListModel::computeNumberOfRows(Context * context) const {
   static_assert(k_maxNumberOfRows >= k_indexOfFactorExpression + 1, "k_maxNumberOfRows must be greater than k_indexOfFactorExpression");
   assert(!m_expression.isUninitialized() && m_expression.type() == ExpressionNode::Type::BasedInteger);
-  Integer integer = static_cast<BasedInteger &>(m_expression).integer();
-  for (int index = 0; index < k_indexOfFactorExpression; ++index) {
-    m_layouts[index] = integer.createLayout(baseAtIndex(index));
-  }
-  // Computing factorExpression
+  // The prime factors row only exists if the factorization succeeds
   Expression factor = Factor::Builder(m_expression.clone());
-  PoincareHelpers::Simplify(&factor, App::app()->localContext(), ExpressionNode::ReductionTarget::User);
-  if (!factor.isUndefined()) {
-    m_layouts[k_indexOfFactorExpression] = PoincareHelpers::CreateLayout(factor);
+  PoincareHelpers::Simplify(&factor, context, ExpressionNode::ReductionTarget::User);
+  if (factor.isUndefined()) {
+    return k_indexOfFactorExpression;
   }
+  m_layouts[k_indexOfFactorExpression] = PoincareHelpers::CreateLayout(factor);
+  return k_indexOfFactorExpression + 1;
+}
+
+Layout IntegerListModel::computeLayoutAtIndex(int index, Context * context) const {
+  // The prime factors layout is memoized when counting the rows
+  assert(index < k_indexOfFactorExpression);
+  Integer integer = static_cast<const BasedInteger &>(m_expression).integer();
+  return integer.createLayout(baseAtIndex(index));
 }
 
-I18n::Message IntegerListController::messageAtIndex(int index) {
+I18n::Message IntegerListModel::messageAtIndex(int index) const {
   switch (index) {
     case 0:
       return I18n::Message::DecimalBase;
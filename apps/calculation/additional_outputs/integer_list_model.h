@@ -0,0 +1,19 @@
+#ifndef CALCULATION_ADDITIONAL_OUTPUTS_INTEGER_LIST_MODEL_H
+#define CALCULATION_ADDITIONAL_OUTPUTS_INTEGER_LIST_MODEL_H
+
+#include "expressions_list_model.h"
+
+namespace Calculation {
+
+class IntegerListModel : public ExpressionsListModel {
+public:
+  I18n::Message messageAtIndex(int index) const override;
+private:
+  int computeNumberOfRows(Poincare::Context * context) const override;
+  Poincare::Layout computeLayoutAtIndex(int index, Poincare::Context * context) const override;
+  static constexpr int k_indexOfFactorExpression = 3;
+};
+
+}
+
+#endif
@@ -2,26 +2,19 @@
 #define CALCULATION_ADDITIONAL_OUTPUTS_MATRIX_LIST_CONTROLLER_H
 
 #include "expressions_list_controller.h"
+#include "matrix_list_model.h"
 
 namespace Calculation {
 
 class MatrixListController : public ExpressionsListController {
 public:
   MatrixListController(EditExpressionController * editExpressionController) :
-    ExpressionsListController(editExpressionController) {}
-
-  void setExpression(Poincare::Expression e) override;
+    ExpressionsListController(editExpressionController, &m_model) {}
 
 private:
-  I18n::Message messageAtIndex(int index) override;
-  Poincare::Layout getLayoutFromExpression(Poincare::Expression e, Poincare::Context * context, Poincare::Preferences * preferences);
-  // Map from cell index to message index
-  constexpr static int k_maxNumberOfOutputRows = 5;
-  int m_indexMessageMap[k_maxNumberOfOutputRows];
+  MatrixListModel m_model;
 };
 
 }
 
 #endif
-
-
@@ -0,0 +1,126 @@
+#include "matrix_list_model.h"
+#include "../../shared/poincare_helpers.h"
+#include <apps/global_preferences.h>
+#include <poincare_nodes.h>
+#include <poincare/matrix.h>
+#include <string.h>
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Calculation {
+
+/* Temporary change complex format to avoid all additional expressions to be
+ * "unreal" (with [i] for instance). As additional results are computed from
+ * the output, which is built taking ComplexFormat into account, there are no
+ * risks of displaying additional results on an unreal output. The previous
+ * complex format is returned to be restored. */
+static Preferences::ComplexFormat UseCartesianInsteadOfReal(Preferences * preferences) {
+  Preferences::ComplexFormat currentComplexFormat = preferences->complexFormat();
+  if (currentComplexFormat == Preferences::ComplexFormat::Real) {
+    preferences->setComplexFormat(Preferences::ComplexFormat::Cartesian);
+  }
+  return currentComplexFormat;
+}
+
+int MatrixListModel::computeNumberOfRows(Context * context) const {
+  assert(!m_expression.isUninitialized());
+  static_assert(k_maxNumberOfRows >= k_maxNumberOfOutputRows, "k_maxNumberOfRows must be greater than k_maxNumberOfOutputRows");
+  // The expression must be reduced to call methods such as determinant or trace
+  assert(m_expression.type() == ExpressionNode::Type::Matrix);
+
+  bool mIsSquared = (static_cast<const Matrix &>(m_expression).numberOfRows() == static_cast<const Matrix &>(m_expression).numberOfColumns());
+  int index = 0;
+  // 1. Matrix determinant if square matrix
+  if (mIsSquared) {
+    Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
+    Preferences::ComplexFormat currentComplexFormat = UseCartesianInsteadOfReal(preferences);
+    ExpressionNode::ReductionContext reductionContext(
+      context,
+      preferences->complexFormat(),
+      preferences->angleUnit(),
+      GlobalPreferences::sharedGlobalPreferences()->unitFormat(),
+      ExpressionNode::ReductionTarget::SystemForApproximation,
+      ExpressionNode::SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined);
+    /* Determinant is reduced so that a null determinant can be detected.
+     * However, some exceptions remain such as cos(x)^2+sin(x)^2-1 which will
+     * not be reduced to a rational, but will be null in theory. The
+     * determinant is needed to count the rows, so its layout is memoized. */
+    Expression determinant = Determinant::Builder(m_expression.clone()).reduce(reductionContext);
+    m_indexMessageMap[index] = MessageIndex::Determinant;
+    m_layouts[index++] = getLayoutFromExpression(determinant, context, preferences);
+    // 2. Matrix inverse if invertible matrix
+    // A squared matrix is invertible if and only if determinant is non null
+    if (!determinant.isUndefined() && determinant.nullStatus(context) != ExpressionNode::NullStatus::Null) {
+      // TODO: Handle ExpressionNode::NullStatus::Unknown
+      m_indexMessageMap[index++] = MessageIndex::Inverse;
+    }
+    // Reset complex format as before
+    preferences->setComplexFormat(currentComplexFormat);
+  }
+  // 3. Matrix row echelon form
+  m_indexMessageMap[index++] = MessageIndex::RowEchelonForm;
+  // 4. Matrix reduced row echelon form
+  m_indexMessageMap[index++] = MessageIndex::ReducedRowEchelonForm;
+  // 5. Matrix trace if square matrix
+  if (mIsSquared) {
+    m_indexMessageMap[index++] = MessageIndex::Trace;
+  }
+  return index;
+}
+
+Layout MatrixListModel::computeLayoutAtIndex(int index, Context * context) const {
+  Expression e;
+  switch (m_indexMessageMap[index]) {
+    case MessageIndex::Inverse:
+      e = MatrixInverse::Builder(m_expression.clone());
+      break;
+    case MessageIndex::RowEchelonForm:
+      e = MatrixRowEchelonForm::Builder(m_expression.clone());
+      break;
+    case MessageIndex::ReducedRowEchelonForm:
+      // It is computed from the row echelon form to save computation time
+      e = MatrixReducedRowEchelonForm::Builder(MatrixRowEchelonForm::Builder(m_expression.clone()));
+      break;
+    default:
+      // The determinant layout is memoized when counting the rows
+      assert(m_indexMessageMap[index] == MessageIndex::Trace);
+      e = MatrixTrace::Builder(m_expression.clone());
+  }
+  Poincare::Preferences * preferences = Poincare::Preferences::sharedPreferences();
+  Preferences::ComplexFormat currentComplexFormat = UseCartesianInsteadOfReal(preferences);
+  Layout layout = getLayoutFromExpression(e, context, preferences);
+  // Reset complex format as before
+  preferences->setComplexFormat(currentComplexFormat);
+  return layout;
+}
+
+Poincare::Layout MatrixListModel::getLayoutFromExpression(Expression e, Context * context, Poincare::Preferences * preferences) const {
+  assert(!e.isUninitialized());
+  // Simplify or approximate expression
+  Expression approximateExpression;
+  Expression simplifiedExpression;
+  e.simplifyAndApproximate(&simplifiedExpression, &approximateExpression, context,
+    preferences->complexFormat(), preferences->angleUnit(), GlobalPreferences::sharedGlobalPreferences()->unitFormat(),
+    ExpressionNode::SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined);
+  // simplify might have been interrupted, in which case we use approximate
+  if (simplifiedExpression.isUninitialized()) {
+    assert(!approximateExpression.isUninitialized());
+    return Shared::PoincareHelpers::CreateLayout(approximateExpression);
+  }
+  return Shared::PoincareHelpers::CreateLayout(simplifiedExpression);
+}
+
+I18n::Message MatrixListModel::messageAtIndex(int index) const {
+  // Message index is mapped in computeNumberOfRows because it depends on the Matrix.
+  assert(index < k_maxNumberOfOutputRows && index >=0);
+  I18n::Message messages[k_maxNumberOfOutputRows] = {
+    I18n::Message::AdditionalDeterminant,
+    I18n::Message::AdditionalInverse,
+    I18n::Message::AdditionalRowEchelonForm,
+    I18n::Message::AdditionalReducedRowEchelonForm,
+    I18n::Message::AdditionalTrace};
+  return messages[m_indexMessageMap[index]];
+}
+
+}
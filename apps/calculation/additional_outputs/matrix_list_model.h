@@ -0,0 +1,30 @@
+#ifndef CALCULATION_ADDITIONAL_OUTPUTS_MATRIX_LIST_MODEL_H
+#define CALCULATION_ADDITIONAL_OUTPUTS_MATRIX_LIST_MODEL_H
+
+#include "expressions_list_model.h"
+#include <poincare/preferences.h>
+
+namespace Calculation {
+
+class MatrixListModel : public ExpressionsListModel {
+public:
+  I18n::Message messageAtIndex(int index) const override;
+private:
+  int computeNumberOfRows(Poincare::Context * context) const override;
+  Poincare::Layout computeLayoutAtIndex(int index, Poincare::Context * context) const override;
+  Poincare::Layout getLayoutFromExpression(Poincare::Expression e, Poincare::Context * context, Poincare::Preferences * preferences) const;
+  enum MessageIndex {
+    Determinant = 0,
+    Inverse,
+    RowEchelonForm,
+    ReducedRowEchelonForm,
+    Trace
+  };
+  // Map from cell index to message index
+  constexpr static int k_maxNumberOfOutputRows = 5;
+  mutable int m_indexMessageMap[k_maxNumberOfOutputRows];
+};
+
+}
+
+#endif
@@ -0,0 +1,47 @@
+#include "rational_list_model.h"
+#include "../../shared/poincare_helpers.h"
+#include <poincare_nodes.h>
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Calculation {
+
+Integer extractInteger(const Expression e) {
+  assert(e.type() == ExpressionNode::Type::BasedInteger);
+  return static_cast<const BasedInteger &>(e).integer();
+}
+
+Layout RationalListModel::computeLayoutAtIndex(int index, Context * context) const {
+  assert(!m_expression.isUninitialized());
+  static_assert(k_maxNumberOfRows >= 2, "k_maxNumberOfRows must be greater than 2");
+
+  bool negative = false;
+  Expression div = m_expression;
+  if (m_expression.type() == ExpressionNode::Type::Opposite) {
+    negative = true;
+    div = m_expression.childAtIndex(0);
+  }
+
+  assert(div.type() == ExpressionNode::Type::Division);
+  Integer numerator = extractInteger(div.childAtIndex(0));
+  numerator.setNegative(negative);
+  Integer denominator = extractInteger(div.childAtIndex(1));
+
+  if (index == 0) {
+    return PoincareHelpers::CreateLayout(Integer::CreateMixedFraction(numerator, denominator));
+  }
+  assert(index == 1);
+  return PoincareHelpers::CreateLayout(Integer::CreateEuclideanDivision(numerator, denominator));
+}
+
+I18n::Message RationalListModel::messageAtIndex(int index) const {
+  switch (index) {
+    case 0:
+      return I18n::Message::MixedFraction;
+    default:
+      return I18n::Message::EuclideanDivision;
+  }
+}
+
+}
@@ -0,0 +1,18 @@
+#ifndef CALCULATION_ADDITIONAL_OUTPUTS_RATIONAL_LIST_MODEL_H
+#define CALCULATION_ADDITIONAL_OUTPUTS_RATIONAL_LIST_MODEL_H
+
+#include "expressions_list_model.h"
+
+namespace Calculation {
+
+class RationalListModel : public ExpressionsListModel {
+public:
+  I18n::Message messageAtIndex(int index) const override;
+private:
+  int computeNumberOfRows(Poincare::Context * context) const override { return 2; }
+  Poincare::Layout computeLayoutAtIndex(int index, Poincare::Context * context) const override;
+};
+
+}
+
+#endif
@@ -2,18 +2,17 @@
 #define CALCULATION_ADDITIONAL_OUTPUTS_UNIT_LIST_CONTROLLER_H
 
 #include "expressions_list_controller.h"
+#include "unit_list_model.h"
 
 namespace Calculation {
 
 class UnitListController : public ExpressionsListController {
 public:
   UnitListController(EditExpressionController * editExpressionController) :
-    ExpressionsListController(editExpressionController) {}
-
-  void setExpression(Poincare::Expression e) override;
+    ExpressionsListController(editExpressionController, &m_model) {}
 
 private:
-  I18n::Message messageAtIndex(int index) override;
+  UnitListModel m_model;
 };
 
 }
@@ -0,0 +1,123 @@
+#include "unit_list_model.h"
+#include "../../shared/poincare_helpers.h"
+#include <apps/constant.h>
+#include <ion.h>
+#include <string.h>
+#include <poincare/unit_convert.h>
+#include <poincare/multiplication.h>
+#include <poincare/power.h>
+#include <poincare/undefined.h>
+#include <poincare/unit.h>
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Calculation {
+
+static uint32_t SerializationChecksum(Expression e, char * buffer, int bufferSize) {
+  int length = PoincareHelpers::Serialize(e, buffer, bufferSize);
+  return Ion::crc32Byte(reinterpret_cast<const uint8_t *>(buffer), length);
+}
+
+static bool HaveSameSerialization(Expression e1, Expression e2, char * buffer1, char * buffer2, int bufferSize) {
+  int size1 = PoincareHelpers::Serialize(e1, buffer1, bufferSize);
+  int size2 = PoincareHelpers::Serialize(e2, buffer2, bufferSize);
+  return size1 == size2 && strcmp(buffer1, buffer2) == 0;
+}
+
+static ExpressionNode::ReductionContext AdditionalExpressionsReductionContext(Context * context) {
+  return ExpressionNode::ReductionContext(
+      context,
+      Preferences::sharedPreferences()->complexFormat(),
+      Preferences::sharedPreferences()->angleUnit(),
+      GlobalPreferences::sharedGlobalPreferences()->unitFormat(),
+      ExpressionNode::ReductionTarget::User,
+      ExpressionNode::SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined);
+}
+
+void UnitListModel::setExpression(Expression e) {
+  ExpressionsListModel::setExpression(e);
+  m_units = Expression();
+}
+
+int UnitListModel::computeNumberOfRows(Context * context) const {
+  assert(!m_expression.isUninitialized());
+  static_assert(k_maxNumberOfRows >= 3, "k_maxNumberOfRows must be greater than 3");
+
+  Poincare::Expression expressions[k_maxNumberOfRows];
+  // Initialize expressions
+  for (size_t i = 0; i < k_maxNumberOfRows; i++) {
+    expressions[i] = Expression();
+  }
+
+  /* 1. First candidates: miscellaneous classic units for some dimensions, in
+   * both metric and imperial units. The units and the value are kept to build
+   * them again cheaply when their rows are displayed. */
+  Expression copy = m_expression.clone();
+  m_units = Expression();
+  // Reduce to be able to recognize units
+  PoincareHelpers::ReduceAndRemoveUnit(&copy, context, ExpressionNode::ReductionTarget::User, &m_units);
+  m_value = Shared::PoincareHelpers::ApproximateToScalar<double>(copy, context);
+  m_numberOfAdditionalExpressions = Unit::SetAdditionalExpressions(m_units, m_value, expressions, k_maxNumberOfRows, AdditionalExpressionsReductionContext(context));
+
+  // 2. Last candidate: SI units only
+  assert(m_numberOfAdditionalExpressions < k_maxNumberOfRows - 1);
+  int numberOfCandidates = m_numberOfAdditionalExpressions + 1;
+  Expression internationalSystemExpression = m_expression.clone();
+  Shared::PoincareHelpers::Simplify(&internationalSystemExpression, context, ExpressionNode::ReductionTarget::User, Poincare::ExpressionNode::SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition, Poincare::ExpressionNode::UnitConversion::InternationalSystem);
+  expressions[m_numberOfAdditionalExpressions] = internationalSystemExpression;
+
+  /* 3. Get rid of duplicates
+   * The candidates are needed to tell which rows exist, but only the index of
+   * each remaining one is kept: their layouts are built when displayed, except
+   * for the SI units one which is memoized as it is costly to build again.
+   * We find duplicates by comparing the serializations, to eliminate
+   * expressions that only differ by the types of their number nodes. Each
+   * expression is serialized once and the checksums of the serializations are
+   * compared. Serializations are only compared in full when checksums match. */
+  Expression reduceExpression = m_expression.clone();
+  // Make m_expression comparable to expressions (turn BasedInteger into Rational for instance)
+  Shared::PoincareHelpers::Simplify(&reduceExpression, context, ExpressionNode::ReductionTarget::User, Poincare::ExpressionNode::SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition, Poincare::ExpressionNode::UnitConversion::None);
+  constexpr int buffersSize = Constant::MaxSerializedExpressionSize;
+  char buffer1[buffersSize];
+  char buffer2[buffersSize];
+  uint32_t reducedExpressionChecksum = SerializationChecksum(reduceExpression, buffer1, buffersSize);
+  uint32_t checksums[k_maxNumberOfRows];
+  int numberOfUniqueExpressions = 0;
+  for (int i = 0; i < numberOfCandidates; i++) {
+    uint32_t checksum = SerializationChecksum(expressions[i], buffer1, buffersSize);
+    // Compare the expression to m_expression and to all previous expressions
+    bool duplicateFound = checksum == reducedExpressionChecksum && HaveSameSerialization(expressions[i], reduceExpression, buffer1, buffer2, buffersSize);
+    for (int j = 0; j < numberOfUniqueExpressions && !duplicateFound; j++) {
+      duplicateFound = checksum == checksums[j] && HaveSameSerialization(expressions[i], expressions[m_candidateIndexes[j]], buffer1, buffer2, buffersSize);
+    }
+    if (!duplicateFound) {
+      m_candidateIndexes[numberOfUniqueExpressions] = i;
+      checksums[numberOfUniqueExpressions] = checksum;
+      numberOfUniqueExpressions++;
+    }
+  }
+  int lastRow = numberOfUniqueExpressions - 1;
+  if (lastRow >= 0 && m_candidateIndexes[lastRow] == m_numberOfAdditionalExpressions) {
+    m_layouts[lastRow] = Shared::PoincareHelpers::CreateLayout(internationalSystemExpression);
+  }
+  return numberOfUniqueExpressions;
+}
+
+Layout UnitListModel::computeLayoutAtIndex(int index, Context * context) const {
+  // The SI units layout is memoized when counting the rows
+  int candidateIndex = m_candidateIndexes[index];
+  assert(candidateIndex < m_numberOfAdditionalExpressions);
+  // Additional expressions are cheaply built from the units and the value
+  Expression expressions[k_maxNumberOfRows];
+  int numberOfExpressions = Unit::SetAdditionalExpressions(m_units, m_value, expressions, k_maxNumberOfRows, AdditionalExpressionsReductionContext(context));
+  assert(numberOfExpressions == m_numberOfAdditionalExpressions);
+  (void)numberOfExpressions;
+  return Shared::PoincareHelpers::CreateLayout(expressions[candidateIndex]);
+}
+
+I18n::Message UnitListModel::messageAtIndex(int index) const {
+  return (I18n::Message)0;
+}
+
+}
@@ -0,0 +1,33 @@
+#ifndef CALCULATION_ADDITIONAL_OUTPUTS_UNIT_LIST_MODEL_H
+#define CALCULATION_ADDITIONAL_OUTPUTS_UNIT_LIST_MODEL_H
+
+#include "expressions_list_model.h"
+#include <cmath>
+
+namespace Calculation {
+
+class UnitListModel : public ExpressionsListModel {
+public:
+  UnitListModel() :
+    ExpressionsListModel(),
+    m_value(NAN),
+    m_numberOfAdditionalExpressions(0),
+    m_candidateIndexes{} {}
+  void setExpression(Poincare::Expression e) override;
+  I18n::Message messageAtIndex(int index) const override;
+private:
+  int computeNumberOfRows(Poincare::Context * context) const override;
+  Poincare::Layout computeLayoutAtIndex(int index, Poincare::Context * context) const override;
+  // Units and value of m_expression, computed when counting the rows
+  mutable Poincare::Expression m_units;
+  mutable double m_value;
+  mutable int m_numberOfAdditionalExpressions;
+  /* Candidates are the additional expressions of the units, followed by the
+   * expression in SI units. Duplicates are removed when counting the rows, so
+   * that each row maps to a candidate index. */
+  mutable int m_candidateIndexes[k_maxNumberOfRows];
+};
+
+}
+
+#endif
@@ -0,0 +1,85 @@
+#include <quiz.h>
+#include <apps/shared/global_context.h>
+#include <poincare/test/helper.h>
+#include <string.h>
+#include "../calculation_store.h"
+#include "../additional_outputs/integer_list_model.h"
+#include "../additional_outputs/matrix_list_model.h"
+#include "../additional_outputs/rational_list_model.h"
+#include "../additional_outputs/unit_list_model.h"
+
+using namespace Poincare;
+using namespace Calculation;
+
+static constexpr int calculationBufferSize = 10 * (sizeof(::Calculation::Calculation) + ::Calculation::Calculation::k_numberOfExpressions * ::Constant::MaxSerializedExpressionSize + sizeof(::Calculation::Calculation *));
+static char calculationBuffer[calculationBufferSize];
+
+static KDCoordinate dummyHeight(::Calculation::Calculation * c, bool expanded) { return 0; }
+
+/* The model is given the exact output of the calculation, as the history
+ * controller does when opening the additional outputs. */
+void assert_additional_outputs_are(const char * input, ExpressionsListModel * model, std::initializer_list<const char *> expectedRows, Context * context) {
+  CalculationStore store(calculationBuffer, calculationBufferSize);
+  store.push(input, context, dummyHeight);
+  model->setExpression(store.calculationAtIndex(0)->exactOutput());
+  quiz_assert_print_if_failure(model->numberOfRows(context) == static_cast<int>(expectedRows.size()), input);
+  int i = 0;
+  for (const char * expectedRow : expectedRows) {
+    /* Layouts are compared through the expressions they are parsed into, as
+     * their serialization adds parentheses. */
+    constexpr int bufferSize = 100;
+    char buffer[bufferSize];
+    model->layoutAtIndex(i++, context).serializeForParsing(buffer, bufferSize);
+    Expression row = Expression::Parse(buffer, context, false);
+    Expression expectedExpression = Expression::Parse(expectedRow, context, false);
+    quiz_assert_print_if_failure(!row.isUninitialized() && row.isIdenticalToWithoutParentheses(expectedExpression), buffer);
+  }
+  store.deleteAll();
+}
+
+QUIZ_CASE(calculation_additional_outputs_integer) {
+  Shared::GlobalContext globalContext;
+  IntegerListModel model;
+  assert_additional_outputs_are("12", &model, {"12", "0xC", "0b1100", "2^2×3"}, &globalContext);
+  quiz_assert(model.messageAtIndex(0) == I18n::Message::DecimalBase);
+  quiz_assert(model.messageAtIndex(3) == I18n::Message::PrimeFactors);
+  // Setting another expression invalidates the memoized rows
+  assert_additional_outputs_are("13", &model, {"13", "0xD", "0b1101", "13"}, &globalContext);
+  // Setting an uninitialized expression releases them
+  model.setExpression(Expression());
+  quiz_assert(model.numberOfRows(&globalContext) == 0);
+}
+
+QUIZ_CASE(calculation_additional_outputs_rational) {
+  Shared::GlobalContext globalContext;
+  RationalListModel model;
+  assert_additional_outputs_are("7/3", &model, {"2+1/3", "7=3×2+1"}, &globalContext);
+  assert_additional_outputs_are("-7/3", &model, {"-2-1/3", "-7=3×(-3)+2"}, &globalContext);
+  model.setExpression(Expression());
+}
+
+QUIZ_CASE(calculation_additional_outputs_matrix) {
+  Shared::GlobalContext globalContext;
+  MatrixListModel model;
+  assert_additional_outputs_are("[[1,2][3,4]]", &model, {"-2", "[[-2,1][3/2,-1/2]]", "[[1,4/3][0,1]]", "[[1,0][0,1]]", "5"}, &globalContext);
+  quiz_assert(model.messageAtIndex(1) == I18n::Message::AdditionalInverse);
+  // Singular matrices have no inverse row
+  assert_additional_outputs_are("[[1,2][2,4]]", &model, {"0", "[[1,2][0,0]]", "[[1,2][0,0]]", "5"}, &globalContext);
+  quiz_assert(model.messageAtIndex(1) == I18n::Message::AdditionalRowEchelonForm);
+  // Non square matrices have no determinant, inverse nor trace rows
+  assert_additional_outputs_are("[[1,2,3]]", &model, {"[[1,2,3]]", "[[1,2,3]]"}, &globalContext);
+  quiz_assert(model.messageAtIndex(0) == I18n::Message::AdditionalRowEchelonForm);
+  model.setExpression(Expression());
+}
+
+QUIZ_CASE(calculation_additional_outputs_unit) {
+  Shared::GlobalContext globalContext;
+  UnitListModel model;
+  // Rows identical to the output are removed
+  assert_additional_outputs_are("3_h", &model, {"10800×_s"}, &globalContext);
+  assert_additional_outputs_are("1_J", &model, {"277.7778×_μW×_h", "6241509×_TeV", "1×_kg×_m^2×_s^(-2)"}, &globalContext);
+  // Rows identical to previous ones are removed
+  assert_additional_outputs_are("20_°C", &model, {"68×_°F", "293.15×_K"}, &globalContext);
+  assert_additional_outputs_are("2_m", &model, {}, &globalContext);
+  model.setExpression(Expression());
+}
@@ -66,8 +66,17 @@ void ConsoleController::unloadPythonEnvironment() {
 }
 
 void ConsoleController::autoImport() {
+  /* Running "from script import *" for each script would execute them all
+   * each time the console opens. They are only registered instead, and
+   * imported the first time the console looks up a name they may define. */
   for (int i = 0; i < m_scriptStore->numberOfScripts(); i++) {
-    autoImportScript(m_scriptStore->scriptAtIndex(i));
+    Script script = m_scriptStore->scriptAtIndex(i);
+    if (script.autoImportationStatus()) {
+      const char * scriptName = script.fullName();
+      MicroPython::registerAutoImportedScript(scriptName, strlen(scriptName) - ScriptStore::k_scriptExtensionLength - 1);
+      // The variable box lists the names of the scripts fetched from console
+      script.setFetchedFromConsole(true);
+    }
   }
 }
 
@@ -16,8 +16,14 @@ public:
     return recordSatisfyingTestAtIndex(i, &isFunctionActiveOfType, &plotType);
   }
   Shared::ExpiringPointer<Shared::ContinuousFunction> modelForRecord(Ion::Storage::Record record) const { return Shared::ExpiringPointer<Shared::ContinuousFunction>(static_cast<Shared::ContinuousFunction *>(privateModelForRecord(record))); }
-  Shared::ContinuousFunctionCache * cacheAtIndex(int i) const { return (i < Shared::ContinuousFunctionCache::k_numberOfAvailableCaches) ? m_functionCaches + i : nullptr; }
+  Shared::ContinuousFunctionCache * cacheAtIndex(int i) const { return (i < k_numberOfCaches) ? m_functionCaches + i : nullptr; }
   Ion::Storage::Record::ErrorStatus addEmptyModel() override;
+  /* Caches are bounded by a memory budget rather than by a number of curves.
+   * There is no point in having more caches than memoized models: the cache of
+   * a function is dropped whenever its model is evicted from memoization. */
+  constexpr static size_t k_cachesMemoryBudget = 13 * 1024;
+  constexpr static int k_numberOfCachesInBudget = k_cachesMemoryBudget / sizeof(Shared::ContinuousFunctionCache);
+  constexpr static int k_numberOfCaches = k_numberOfCachesInBudget < k_maxNumberOfMemoizedModels ? k_numberOfCachesInBudget : k_maxNumberOfMemoizedModels;
 private:
   const char * modelExtension() const override { return Ion::Storage::funcExtension; }
   Shared::ExpressionModelHandle * setMemoizedModelAtIndex(int cacheIndex, Ion::Storage::Record record) const override;
@@ -27,7 +33,7 @@ private:
     return isFunctionActive(model, context) && plotType == static_cast<Shared::ContinuousFunction *>(model)->plotType();
   }
   mutable Shared::ContinuousFunction m_functions[k_maxNumberOfMemoizedModels];
-  mutable Shared::ContinuousFunctionCache m_functionCaches[Shared::ContinuousFunctionCache::k_numberOfAvailableCaches];
+  mutable Shared::ContinuousFunctionCache m_functionCaches[k_numberOfCaches];
 
 };
 
@@ -121,4 +121,19 @@ QUIZ_CASE(graph_caching) {
   assert_cache_stays_valid(Polar, "cos(5θ)", -1e8f, 1e8f);
 }
 
+QUIZ_CASE(graph_caching_all_active_functions) {
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  constexpr int numberOfFunctions = 6;
+  static_assert(numberOfFunctions <= ContinuousFunctionStore::k_numberOfCaches, "Every active function should be cached");
+  const char * definitions[numberOfFunctions] = {"x", "x^2", "sin(x)", "1/x", "cos(x)", "-ℯ^x"};
+  for (int i = 0; i < numberOfFunctions; i++) {
+    addFunction(definitions[i], Cartesian, &functionStore, &globalContext);
+  }
+  for (int i = 0; i < numberOfFunctions; i++) {
+    quiz_assert(functionStore.cacheAtIndex(i) != nullptr);
+  }
+  functionStore.removeAll();
+}
+
 }
@@ -0,0 +1,68 @@
+#include <quiz.h>
+#include "helper.h"
+#include <apps/shared/reduced_expression_cache.h>
+
+using namespace Poincare;
+using namespace Shared;
+
+namespace Graph {
+
+double valueOfFunctionAtRecord(Ion::Storage::Record record, double x, ContinuousFunctionStore * store, Context * context) {
+  return store->modelForRecord(record)->evaluateXYAtParameter(x, context).x2();
+}
+
+QUIZ_CASE(graph_reduced_expressions_persistence) {
+  GlobalContext globalContext;
+  ContinuousFunctionStore functionStore;
+  addFunction("a×x+1", Cartesian, &functionStore, &globalContext);
+  Ion::Storage::Record record = functionStore.recordAtIndex(0);
+
+  uint32_t checksum = ReducedExpressionCache::DependenciesChecksum();
+  quiz_assert(ReducedExpressionCache::ExpressionForRecord(&record, 0, checksum).isUninitialized());
+  Expression reduced = functionStore.modelForRecord(record)->expressionReduced(&globalContext);
+  quiz_assert(ReducedExpressionCache::ExpressionForRecord(&record, 0, checksum).isIdenticalTo(reduced));
+
+  // The cache record is hidden from Python
+  Ion::Storage::Record cacheRecord = Ion::Storage::sharedStorage()->recordWithExtensionAtIndex(Ion::Storage::cacheExtension, 0);
+  quiz_assert(ReducedExpressionCache::IsCacheRecord(cacheRecord));
+  quiz_assert(Ion::Storage::FullNameIsCache(cacheRecord.fullName()));
+
+  // A truncated entry is not read
+  Ion::Storage::Record::Data data = cacheRecord.value();
+  data.size--;
+  quiz_assert(cacheRecord.setValue(data) == Ion::Storage::Record::ErrorStatus::None);
+  quiz_assert(ReducedExpressionCache::ExpressionForRecord(&record, 0, checksum).isUninitialized());
+  // The corrupted entries are then discarded
+  functionStore.tidy();
+  quiz_assert(functionStore.modelForRecord(record)->expressionReduced(&globalContext).isIdenticalTo(reduced));
+  quiz_assert(ReducedExpressionCache::ExpressionForRecord(&record, 0, checksum).isIdenticalTo(reduced));
+
+  // The reduced expression outlives the memoized model
+  functionStore.tidy();
+  quiz_assert(ReducedExpressionCache::DependenciesChecksum() == checksum);
+  quiz_assert(functionStore.modelForRecord(record)->expressionReduced(&globalContext).isIdenticalTo(reduced));
+
+  // Defining a symbol used by the function discards the reduced expression
+  globalContext.setExpressionForSymbolAbstract(Rational::Builder(2), Symbol::Builder("a", 1));
+  uint32_t checksumWithSymbol = ReducedExpressionCache::DependenciesChecksum();
+  quiz_assert(checksumWithSymbol != checksum);
+  quiz_assert(ReducedExpressionCache::ExpressionForRecord(&record, 0, checksumWithSymbol).isUninitialized());
+  functionStore.tidy();
+  quiz_assert(valueOfFunctionAtRecord(record, 0.0, &functionStore, &globalContext) == 1.0);
+  quiz_assert(valueOfFunctionAtRecord(record, 3.0, &functionStore, &globalContext) == 7.0);
+
+  // So does changing the angle unit
+  Preferences * preferences = Preferences::sharedPreferences();
+  Preferences::AngleUnit previousAngleUnit = preferences->angleUnit();
+  preferences->setAngleUnit(previousAngleUnit == Preferences::AngleUnit::Radian ? Preferences::AngleUnit::Degree : Preferences::AngleUnit::Radian);
+  quiz_assert(ReducedExpressionCache::DependenciesChecksum() != checksumWithSymbol);
+  preferences->setAngleUnit(previousAngleUnit);
+  quiz_assert(ReducedExpressionCache::DependenciesChecksum() == checksumWithSymbol);
+
+  Ion::Storage::sharedStorage()->destroyRecordWithBaseNameAndExtension("a", Ion::Storage::expExtension);
+  functionStore.removeAll();
+  Ion::Storage::sharedStorage()->destroyRecordsWithExtension(Ion::Storage::cacheExtension);
+  quiz_assert(Ion::Storage::sharedStorage()->numberOfRecordsWithExtension(Ion::Storage::cacheExtension) == 0);
+}
+
+}
@@ -0,0 +1,227 @@
+#include "level_set_helper.h"
+#include <poincare/solver.h>
+#include <assert.h>
+#include <cmath>
+#include <float.h>
+
+namespace Regression {
+
+namespace LevelSetHelper {
+
+static constexpr int k_maxDegree = 4;
+static constexpr int k_numberOfNewtonIterations = 3;
+/* Discriminants are computed on rounded coefficients: a tangent level set may
+ * lead to a slightly negative discriminant, which we consider to be null. */
+static constexpr double k_discriminantTolerance = 1E3 * DBL_EPSILON;
+
+static double evaluatePolynomial(const double * coefficients, int degree, double x, double * derivative) {
+  double value = coefficients[0];
+  double slope = 0.0;
+  for (int i = 1; i <= degree; i++) {
+    slope = slope * x + value;
+    value = value * x + coefficients[i];
+  }
+  *derivative = slope;
+  return value;
+}
+
+static double polish(const double * coefficients, int degree, double x) {
+  for (int i = 0; i < k_numberOfNewtonIterations; i++) {
+    double derivative;
+    double value = evaluatePolynomial(coefficients, degree, x, &derivative);
+    if (value == 0.0 || derivative == 0.0) {
+      break;
+    }
+    double next = x - value / derivative;
+    if (!std::isfinite(next)) {
+      break;
+    }
+    double nextDerivative;
+    // Only keep the Newton step if it actually improves the root
+    if (std::fabs(evaluatePolynomial(coefficients, degree, next, &nextDerivative)) >= std::fabs(value)) {
+      break;
+    }
+    x = next;
+  }
+  return x;
+}
+
+// x^2 + b*x + c
+static int monicQuadraticRoots(double b, double c, double * roots) {
+  double discriminant = b * b - 4.0 * c;
+  if (discriminant < 0.0) {
+    if (discriminant < -k_discriminantTolerance * (b * b + std::fabs(4.0 * c))) {
+      return 0;
+    }
+    discriminant = 0.0;
+  }
+  // Avoid the cancellation of -b + sqrt(discriminant)
+  double q = -0.5 * (b + std::copysign(std::sqrt(discriminant), b));
+  if (q == 0.0) {
+    roots[0] = 0.0;
+    return 1;
+  }
+  roots[0] = q;
+  roots[1] = c / q;
+  return 2;
+}
+
+// x^3 + a*x^2 + b*x + c
+static int monicCubicRoots(double a, double b, double c, double * roots) {
+  double q = (a * a - 3.0 * b) / 9.0;
+  double r = (2.0 * a * a * a - 9.0 * a * b + 27.0 * c) / 54.0;
+  double q3 = q * q * q;
+  double r2 = r * r;
+  if (r2 < q3) {
+    // Three real roots
+    double theta = std::acos(r / std::sqrt(q3));
+    double m = -2.0 * std::sqrt(q);
+    roots[0] = m * std::cos(theta / 3.0) - a / 3.0;
+    roots[1] = m * std::cos((theta + 2.0 * M_PI) / 3.0) - a / 3.0;
+    roots[2] = m * std::cos((theta - 2.0 * M_PI) / 3.0) - a / 3.0;
+    return 3;
+  }
+  double A = -std::copysign(std::cbrt(std::fabs(r) + std::sqrt(r2 - q3)), r);
+  double B = A == 0.0 ? 0.0 : q / A;
+  roots[0] = A + B - a / 3.0;
+  if (r2 - q3 <= k_discriminantTolerance * (r2 + std::fabs(q3))) {
+    // Double root
+    roots[1] = -0.5 * (A + B) - a / 3.0;
+    return 2;
+  }
+  return 1;
+}
+
+// x^4 + a*x^3 + b*x^2 + c*x + d, with Ferrari's method
+static int monicQuarticRoots(double a, double b, double c, double d, double * roots) {
+  // Depressed quartic t^4 + p*t^2 + q*t + r with x = t - a/4
+  double shift = -a / 4.0;
+  double a2 = a * a;
+  double p = b - 3.0 * a2 / 8.0;
+  double q = c - a * b / 2.0 + a2 * a / 8.0;
+  double r = d - a * c / 4.0 + a2 * b / 16.0 - 3.0 * a2 * a2 / 256.0;
+  int numberOfRoots = 0;
+  double quadraticRoots[2];
+  if (std::fabs(q) <= k_discriminantTolerance * (std::fabs(p) * std::sqrt(std::fabs(r)) + std::fabs(r) + 1.0)) {
+    // Biquadratic: u^2 + p*u + r with u = t^2
+    int n = monicQuadraticRoots(p, r, quadraticRoots);
+    for (int i = 0; i < n; i++) {
+      if (quadraticRoots[i] >= 0.0) {
+        double t = std::sqrt(quadraticRoots[i]);
+        roots[numberOfRoots++] = t + shift;
+        if (t != 0.0) {
+          roots[numberOfRoots++] = -t + shift;
+        }
+      }
+    }
+    return numberOfRoots;
+  }
+  /* The resolvent cubic 8m^3 + 8p*m^2 + (2p^2-8r)*m - q^2 has a positive root
+   * m, which splits the quartic into two quadratics. */
+  double cubicRoots[3];
+  int n = monicCubicRoots(p, p * p / 4.0 - r, -q * q / 8.0, cubicRoots);
+  double m = cubicRoots[0];
+  for (int i = 1; i < n; i++) {
+    m = std::fmax(m, cubicRoots[i]);
+  }
+  if (m <= 0.0) {
+    return 0;
+  }
+  double s = std::sqrt(2.0 * m);
+  double offset = q / (2.0 * s);
+  n = monicQuadraticRoots(-s, p / 2.0 + m + offset, quadraticRoots);
+  for (int i = 0; i < n; i++) {
+    roots[numberOfRoots++] = quadraticRoots[i] + shift;
+  }
+  n = monicQuadraticRoots(s, p / 2.0 + m - offset, quadraticRoots);
+  for (int i = 0; i < n; i++) {
+    roots[numberOfRoots++] = quadraticRoots[i] + shift;
+  }
+  return numberOfRoots;
+}
+
+int PolynomialRealRoots(const double * coefficients, int degree, double * roots) {
+  assert(degree <= k_maxDegree);
+  // Drop null leading coefficients
+  while (degree > 0 && coefficients[0] == 0.0) {
+    coefficients++;
+    degree--;
+  }
+  if (degree == 0 || !std::isfinite(coefficients[0])) {
+    return 0;
+  }
+  double monic[k_maxDegree + 1];
+  for (int i = 0; i <= degree; i++) {
+    monic[i] = coefficients[i] / coefficients[0];
+  }
+  int numberOfRoots = 0;
+  switch (degree) {
+    case 1:
+      roots[0] = -monic[1];
+      numberOfRoots = 1;
+      break;
+    case 2:
+      numberOfRoots = monicQuadraticRoots(monic[1], monic[2], roots);
+      break;
+    case 3:
+      numberOfRoots = monicCubicRoots(monic[1], monic[2], monic[3], roots);
+      break;
+    default:
+      assert(degree == 4);
+      numberOfRoots = monicQuarticRoots(monic[1], monic[2], monic[3], monic[4], roots);
+  }
+  for (int i = 0; i < numberOfRoots; i++) {
+    roots[i] = polish(coefficients, degree, roots[i]);
+  }
+  return numberOfRoots;
+}
+
+double FirstRootInRange(const double * roots, int numberOfRoots, double xMin, double xMax) {
+  double result = NAN;
+  for (int i = 0; i < numberOfRoots; i++) {
+    if (roots[i] > xMin && roots[i] <= xMax && !(roots[i] >= result)) {
+      result = roots[i];
+    }
+  }
+  return result;
+}
+
+struct BracketedEvaluation {
+  Evaluation evaluation;
+  const void * context1;
+  const void * context2;
+};
+
+double NextRoot(Evaluation evaluation, const void * context1, const void * context2, double xMin, double step, double xMax) {
+  if (!(step > 0.0) || !(xMin < xMax)) {
+    return NAN;
+  }
+  // Brent's method expects a Solver::ValueAtAbscissa
+  BracketedEvaluation bracketedEvaluation = {evaluation, context1, context2};
+  Poincare::Solver::ValueAtAbscissa brentEvaluation = [](double x, Poincare::Context * context, Poincare::Preferences::ComplexFormat complexFormat, Poincare::Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
+    const BracketedEvaluation * e = static_cast<const BracketedEvaluation *>(context1);
+    return e->evaluation(x, e->context1, e->context2);
+  };
+  double a = xMin;
+  double fa = evaluation(a, context1, context2);
+  while (a < xMax) {
+    double b = std::fmin(a + step, xMax);
+    double fb = evaluation(b, context1, context2);
+    if (fb == 0.0) {
+      return b;
+    }
+    if ((fa < 0.0 && fb > 0.0) || (fa > 0.0 && fb < 0.0)) {
+      double root = Poincare::Solver::BrentRoot(a, b, step * 1E-6, brentEvaluation, nullptr, Poincare::Preferences::ComplexFormat::Real, Poincare::Preferences::AngleUnit::Radian, &bracketedEvaluation);
+      if (!std::isnan(root)) {
+        return root;
+      }
+    }
+    a = b;
+    fa = fb;
+  }
+  return NAN;
+}
+
+}
+
+}
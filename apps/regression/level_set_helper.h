@@ -0,0 +1,26 @@
+#ifndef REGRESSION_LEVEL_SET_HELPER
+#define REGRESSION_LEVEL_SET_HELPER
+
+namespace Regression {
+
+namespace LevelSetHelper {
+
+/* Real roots of the polynomial of given degree, whose coefficients are ordered
+ * by decreasing powers. The roots are polished with a few Newton iterations.
+ * Returns the number of roots stored in roots, which must hold degree values.
+ * Degenerate leading coefficients lower the degree. */
+int PolynomialRealRoots(const double * coefficients, int degree, double * roots);
+
+/* Among roots, returns the smallest one in ]xMin, xMax], or NAN. */
+double FirstRootInRange(const double * roots, int numberOfRoots, double xMin, double xMax);
+
+/* Returns the first x in ]xMin, xMax] where evaluation(x) changes sign, by
+ * scanning with step and refining with Brent's method, or NAN. */
+typedef double (*Evaluation)(double x, const void * context1, const void * context2);
+double NextRoot(Evaluation evaluation, const void * context1, const void * context2, double xMin, double step, double xMax);
+
+}
+
+}
+
+#endif
@@ -1,19 +1,14 @@
 #include "cubic_model.h"
-#include "../../shared/poincare_helpers.h"
+#include "../store.h"
+#include "../level_set_helper.h"
+#include "../polynomial_fit_helper.h"
 #include <math.h>
 #include <assert.h>
 #include <poincare/code_point_layout.h>
 #include <poincare/horizontal_layout.h>
 #include <poincare/vertical_offset_layout.h>
-#include <poincare/decimal.h>
-#include <poincare/number.h>
-#include <poincare/symbol.h>
-#include <poincare/addition.h>
-#include <poincare/multiplication.h>
-#include <poincare/power.h>
 
 using namespace Poincare;
-using namespace Shared;
 
 namespace Regression {
 
@@ -72,33 +67,20 @@ double CubicModel::partialDerivate(double * modelCoefficients, int derivateCoeff
   };
 }
 
-Expression CubicModel::expression(double * modelCoefficients) {
+double CubicModel::levelSet(double * modelCoefficients, double xMin, double step, double xMax, double y, Poincare::Context * context) {
   double a = modelCoefficients[0];
   double b = modelCoefficients[1];
   double c = modelCoefficients[2];
   double d = modelCoefficients[3];
-  // a*x^3+b*x^2+c*x+d
-  return Addition::Builder({
-    Multiplication::Builder({
-      Number::DecimalNumber(a),
-      Power::Builder(
-        Symbol::Builder('x'),
-        Decimal::Builder(3.0)
-      )
-    }),
-    Multiplication::Builder({
-      Number::DecimalNumber(b),
-      Power::Builder(
-        Symbol::Builder('x'),
-        Decimal::Builder(2.0)
-      )
-    }),
-    Multiplication::Builder({
-      Number::DecimalNumber(c),
-      Symbol::Builder('x')
-    }),
-    Number::DecimalNumber(d)
-  });
+  // a*x^3+b*x^2+c*x+d-y = 0
+  const double coefficients[] = {a, b, c, d - y};
+  double roots[3];
+  int numberOfRoots = LevelSetHelper::PolynomialRealRoots(coefficients, 3, roots);
+  return LevelSetHelper::FirstRootInRange(roots, numberOfRoots, xMin, xMax);
+}
+
+bool CubicModel::fitClosedForm(Store * store, int series, double * modelCoefficients) const {
+  return PolynomialFitHelper::Fit(store->polynomialMomentsForSeries(series), 3, modelCoefficients);
 }
 
 }
@@ -1,13 +1,11 @@
 #include "model.h"
 #include "../store.h"
-#include "../../shared/poincare_helpers.h"
-#include <poincare/decimal.h>
+#include "../level_set_helper.h"
 #include <poincare/matrix.h>
 #include <poincare/multiplication.h>
 #include <math.h>
 
 using namespace Poincare;
-using namespace Shared;
 
 namespace Regression {
 
@@ -15,24 +13,26 @@ void Model::tidy() {
   m_layout = Layout();
 }
 
-Poincare::Expression Model::simplifiedExpression(double * modelCoefficients, Poincare::Context * context) {
-  Expression e = expression(modelCoefficients);
-  if (!e.isUninitialized()) {
-    PoincareHelpers::Simplify(&e, context, ExpressionNode::ReductionTarget::SystemForApproximation);
-  }
-  return e;
-}
-
 double Model::levelSet(double * modelCoefficients, double xMin, double step, double xMax, double y, Poincare::Context * context) {
-  Expression yExpression = Number::DecimalNumber(y);
-  PoincareHelpers::Simplify(&yExpression, context, ExpressionNode::ReductionTarget::SystemForApproximation);
-  Expression modelExpression = simplifiedExpression(modelCoefficients, context);
-  double result = PoincareHelpers::NextIntersection(modelExpression, "x", xMin, step, xMax, context, yExpression).x1();
-  return result;
+  /* Models without a closed form level set are solved numerically on their
+   * evaluation, bracketing a root of evaluate(x) - y. */
+  struct LevelSetParameters {
+    const Model * model;
+    double * coefficients;
+    double y;
+  };
+  LevelSetParameters parameters = {this, modelCoefficients, y};
+  return LevelSetHelper::NextRoot([](double x, const void * context1, const void * context2) {
+      const LevelSetParameters * p = static_cast<const LevelSetParameters *>(context1);
+      return p->model->evaluate(p->coefficients, x) - p->y;
+    }, &parameters, nullptr, xMin, step, xMax);
 }
 
 void Model::fit(Store * store, int series, double * modelCoefficients, Poincare::Context * context) {
   if (dataSuitableForFit(store, series)) {
+    if (fitClosedForm(store, series, modelCoefficients)) {
+      return;
+    }
     initCoefficientsForFit(modelCoefficients, k_initialCoefficientValue, false, store, series);
     fitLevenbergMarquardt(store, series, modelCoefficients, context);
     uniformizeCoefficientsFromFit(modelCoefficients);
@@ -31,7 +31,6 @@ public:
   virtual Poincare::Layout layout() = 0;
   // Reinitialize m_layout to empty the pool
   void tidy();
-  Poincare::Expression simplifiedExpression(double * modelCoefficients, Poincare::Context * context);
   virtual I18n::Message formulaMessage() const = 0;
   virtual double evaluate(double * modelCoefficients, double x) const = 0;
   virtual double levelSet(double * modelCoefficients, double xMin, double step, double xMax, double y, Poincare::Context * context);
@@ -41,11 +40,13 @@ public:
 protected:
   // Fit
   virtual bool dataSuitableForFit(Store * store, int series) const;
+  /* Models with a least-squares closed form fill modelCoefficients and return
+   * true, skipping Levenberg-Marquardt. */
+  virtual bool fitClosedForm(Store * store, int series, double * modelCoefficients) const { return false; }
   constexpr static const KDFont * k_layoutFont = KDFont::SmallFont;
   Poincare::Layout m_layout;
 private:
   // Model attributes
-  virtual Poincare::Expression expression(double * modelCoefficients) { return Poincare::Expression(); } // expression is overrided only by Models that do not override levelSet
   virtual double partialDerivate(double * modelCoefficients, int derivateCoefficientIndex, double x) const = 0;
 
   // Levenberg-Marquardt
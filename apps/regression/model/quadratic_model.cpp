@@ -1,19 +1,14 @@
 #include "quadratic_model.h"
-#include "../../shared/poincare_helpers.h"
+#include "../store.h"
+#include "../level_set_helper.h"
+#include "../polynomial_fit_helper.h"
 #include <math.h>
 #include <assert.h>
 #include <poincare/code_point_layout.h>
 #include <poincare/horizontal_layout.h>
 #include <poincare/vertical_offset_layout.h>
-#include <poincare/decimal.h>
-#include <poincare/number.h>
-#include <poincare/symbol.h>
-#include <poincare/addition.h>
-#include <poincare/multiplication.h>
-#include <poincare/power.h>
 
 using namespace Poincare;
-using namespace Shared;
 
 namespace Regression {
 
@@ -59,25 +54,19 @@ double QuadraticModel::partialDerivate(double * modelCoefficients, int derivateC
   return 1.0;
 }
 
-Expression QuadraticModel::expression(double * modelCoefficients) {
+double QuadraticModel::levelSet(double * modelCoefficients, double xMin, double step, double xMax, double y, Poincare::Context * context) {
   double a = modelCoefficients[0];
   double b = modelCoefficients[1];
   double c = modelCoefficients[2];
-  // a*x^2+b*x+c
-  return Addition::Builder({
-    Multiplication::Builder({
-      Number::DecimalNumber(a),
-      Power::Builder(
-        Symbol::Builder('x'),
-        Decimal::Builder(2.0)
-      )
-    }),
-    Multiplication::Builder({
-      Number::DecimalNumber(b),
-      Symbol::Builder('x')
-    }),
-    Number::DecimalNumber(c)
-  });
+  // a*x^2+b*x+c-y = 0
+  const double coefficients[] = {a, b, c - y};
+  double roots[2];
+  int numberOfRoots = LevelSetHelper::PolynomialRealRoots(coefficients, 2, roots);
+  return LevelSetHelper::FirstRootInRange(roots, numberOfRoots, xMin, xMax);
+}
+
+bool QuadraticModel::fitClosedForm(Store * store, int series, double * modelCoefficients) const {
+  return PolynomialFitHelper::Fit(store->polynomialMomentsForSeries(series), 2, modelCoefficients);
 }
 
 }
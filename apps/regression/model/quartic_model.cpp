@@ -1,19 +1,14 @@
 #include "quartic_model.h"
-#include "../../shared/poincare_helpers.h"
+#include "../store.h"
+#include "../level_set_helper.h"
+#include "../polynomial_fit_helper.h"
 #include <math.h>
 #include <assert.h>
 #include <poincare/code_point_layout.h>
 #include <poincare/horizontal_layout.h>
 #include <poincare/vertical_offset_layout.h>
-#include <poincare/decimal.h>
-#include <poincare/number.h>
-#include <poincare/symbol.h>
-#include <poincare/addition.h>
-#include <poincare/multiplication.h>
-#include <poincare/power.h>
 
 using namespace Poincare;
-using namespace Shared;
 
 namespace Regression {
 
@@ -84,41 +79,21 @@ double QuarticModel::partialDerivate(double * modelCoefficients, int derivateCoe
   };
 }
 
-Expression QuarticModel::expression(double * modelCoefficients) {
+double QuarticModel::levelSet(double * modelCoefficients, double xMin, double step, double xMax, double y, Poincare::Context * context) {
   double a = modelCoefficients[0];
   double b = modelCoefficients[1];
   double c = modelCoefficients[2];
   double d = modelCoefficients[3];
   double e = modelCoefficients[4];
-  // a*x^4+b*x^3+c*x^2+d*x+e
-  return Addition::Builder({
-    Multiplication::Builder({
-      Number::DecimalNumber(a),
-      Power::Builder(
-        Symbol::Builder('x'),
-        Decimal::Builder(4.0)
-      )
-    }),
-    Multiplication::Builder({
-      Number::DecimalNumber(b),
-      Power::Builder(
-        Symbol::Builder('x'),
-        Decimal::Builder(3.0)
-      )
-    }),
-    Multiplication::Builder({
-      Number::DecimalNumber(c),
-      Power::Builder(
-        Symbol::Builder('x'),
-        Decimal::Builder(2.0)
-      )
-    }),
-    Multiplication::Builder({
-      Number::DecimalNumber(d),
-      Symbol::Builder('x')
-    }),
-    Number::DecimalNumber(e)
-  });
+  // a*x^4+b*x^3+c*x^2+d*x+e-y = 0
+  const double coefficients[] = {a, b, c, d, e - y};
+  double roots[4];
+  int numberOfRoots = LevelSetHelper::PolynomialRealRoots(coefficients, 4, roots);
+  return LevelSetHelper::FirstRootInRange(roots, numberOfRoots, xMin, xMax);
+}
+
+bool QuarticModel::fitClosedForm(Store * store, int series, double * modelCoefficients) const {
+  return PolynomialFitHelper::Fit(store->polynomialMomentsForSeries(series), 4, modelCoefficients);
 }
 
 }
@@ -11,11 +11,12 @@ public:
   Poincare::Layout layout() override;
   I18n::Message formulaMessage() const override { return I18n::Message::QuarticRegressionFormula; }
   double evaluate(double * modelCoefficients, double x) const override;
+  double levelSet(double * modelCoefficients, double xMin, double step, double xMax, double y, Poincare::Context * context) override;
   double partialDerivate(double * modelCoefficients, int derivateCoefficientIndex, double x) const override;
   int numberOfCoefficients() const override { return 5; }
   int bannerLinesCount() const override { return 4; }
 private:
-  Poincare::Expression expression(double * modelCoefficients) override;
+  bool fitClosedForm(Store * store, int series, double * modelCoefficients) const override;
 };
 
 }
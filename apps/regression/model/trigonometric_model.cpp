@@ -1,19 +1,13 @@
 #include "trigonometric_model.h"
 #include <apps/regression/store.h>
-#include "../../shared/poincare_helpers.h"
-#include <poincare/addition.h>
+#include "../level_set_helper.h"
 #include <poincare/layout_helper.h>
-#include <poincare/multiplication.h>
-#include <poincare/number.h>
-#include <poincare/power.h>
 #include <poincare/preferences.h>
-#include <poincare/sine.h>
-#include <poincare/symbol.h>
+#include <poincare/trigonometry.h>
 #include <assert.h>
 #include <cmath>
 
 using namespace Poincare;
-using namespace Shared;
 
 namespace Regression {
 
@@ -126,24 +120,30 @@ void TrigonometricModel::uniformizeCoefficientsFromFit(double * modelCoefficient
   }
 }
 
-Expression TrigonometricModel::expression(double * modelCoefficients) {
+double TrigonometricModel::levelSet(double * modelCoefficients, double xMin, double step, double xMax, double y, Poincare::Context * context) {
   double a = modelCoefficients[0];
   double b = modelCoefficients[1];
   double c = modelCoefficients[2];
   double d = modelCoefficients[3];
-  // a*sin(bx+c)+d
-  Expression result =
-    Addition::Builder(
-      Multiplication::Builder(
-        Number::DecimalNumber(a),
-        Sine::Builder(
-          Addition::Builder(
-            Multiplication::Builder(
-              Number::DecimalNumber(b),
-              Symbol::Builder('x')),
-            Number::DecimalNumber(c)))),
-      Number::DecimalNumber(d));
-  return result;
+  double radian = toRadians();
+  if (a == 0.0 || b == 0.0) {
+    return NAN;
+  }
+  double sine = (y - d) / a;
+  if (sine < -1.0 || sine > 1.0) {
+    return NAN;
+  }
+  /* a*sin(radian*(b*x+c))+d = y is solved by radian*(b*x+c) = θ + 2kπ with
+   * θ in {asin(sine), π-asin(sine)}. Both families of solutions are periodic
+   * in x, we look for their first element after xMin. */
+  double period = 2.0 * M_PI / (radian * std::fabs(b));
+  double angles[2] = {std::asin(sine), M_PI - std::asin(sine)};
+  double roots[2];
+  for (int i = 0; i < 2; i++) {
+    double x = (angles[i] / radian - c) / b;
+    roots[i] = x + (std::floor((xMin - x) / period) + 1.0) * period;
+  }
+  return LevelSetHelper::FirstRootInRange(roots, 2, xMin, xMax);
 }
 
 }
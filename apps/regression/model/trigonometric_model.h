@@ -11,6 +11,7 @@ public:
   Poincare::Layout layout() override;
   I18n::Message formulaMessage() const override { return I18n::Message::TrigonometricRegressionFormula; }
   double evaluate(double * modelCoefficients, double x) const override;
+  double levelSet(double * modelCoefficients, double xMin, double step, double xMax, double y, Poincare::Context * context) override;
   double partialDerivate(double * modelCoefficients, int derivateCoefficientIndex, double x) const override;
   int numberOfCoefficients() const override { return k_numberOfCoefficients; }
   int bannerLinesCount() const override { return 4; }
@@ -18,7 +19,6 @@ private:
   static constexpr int k_numberOfCoefficients = 4;
   void specializedInitCoefficientsForFit(double * modelCoefficients, double defaultValue, Store * store, int series) const override;
   void uniformizeCoefficientsFromFit(double * modelCoefficients) const override;
-  Poincare::Expression expression(double * modelCoefficients) override;
 };
 
 }
@@ -0,0 +1,51 @@
+#include "model_comparison_cell.h"
+#include "../shared/poincare_helpers.h"
+#include <escher/palette.h>
+#include <poincare/code_point_layout.h>
+#include <poincare/horizontal_layout.h>
+#include <poincare/layout_helper.h>
+#include <poincare/preferences.h>
+#include <poincare/print_float.h>
+#include <poincare/vertical_offset_layout.h>
+
+using namespace Poincare;
+
+namespace Regression {
+
+ModelComparisonCell::ModelComparisonCell() :
+  MessageTableCellWithExpression(),
+  m_determinationCoefficientView(1.0f, 0.5f, Palette::SecondaryText)
+{
+  m_determinationCoefficientView.setHorizontalMargin(k_subAccessoryMargin);
+}
+
+View * ModelComparisonCell::subAccessoryView() const {
+  return (View *)&m_determinationCoefficientView;
+}
+
+void ModelComparisonCell::setHighlighted(bool highlight) {
+  MessageTableCellWithExpression::setHighlighted(highlight);
+  KDColor backgroundColor = isHighlighted()? Palette::ListCellBackgroundSelected : Palette::ListCellBackground;
+  m_determinationCoefficientView.setBackgroundColor(backgroundColor);
+}
+
+void ModelComparisonCell::setDeterminationCoefficient(double r2) {
+  constexpr int precision = Preferences::ShortNumberOfSignificantDigits;
+  constexpr int bufferSize = 1 + PrintFloat::charSizeForFloatsWithPrecision(precision);
+  char buffer[bufferSize];
+  buffer[0] = '=';
+  int length = 1 + Shared::PoincareHelpers::ConvertFloatToText<double>(r2, buffer + 1, bufferSize - 1, precision);
+  HorizontalLayout r2Layout = HorizontalLayout::Builder(
+      CodePointLayout::Builder('r', KDFont::SmallFont),
+      VerticalOffsetLayout::Builder(CodePointLayout::Builder('2', KDFont::SmallFont), VerticalOffsetLayoutNode::Position::Superscript));
+  r2Layout.addOrMergeChildAtIndex(LayoutHelper::String(buffer, length, KDFont::SmallFont), 2, false);
+  m_determinationCoefficientView.setLayout(r2Layout);
+  layoutSubviews();
+}
+
+void ModelComparisonCell::hideDeterminationCoefficient() {
+  m_determinationCoefficientView.setLayout(Poincare::Layout());
+  layoutSubviews();
+}
+
+}
@@ -0,0 +1,26 @@
+#ifndef REGRESSION_MODEL_COMPARISON_CELL_H
+#define REGRESSION_MODEL_COMPARISON_CELL_H
+
+#include <escher/message_table_cell_with_expression.h>
+#include <escher/expression_view.h>
+
+namespace Regression {
+
+/* Regression model cell, displaying the determination coefficient r2 obtained
+ * by this model on the current series next to its formula. */
+
+class ModelComparisonCell : public MessageTableCellWithExpression {
+public:
+  ModelComparisonCell();
+  View * subAccessoryView() const override;
+  void setHighlighted(bool highlight) override;
+  void setDeterminationCoefficient(double r2);
+  void hideDeterminationCoefficient();
+private:
+  constexpr static KDCoordinate k_subAccessoryMargin = 8;
+  ExpressionView m_determinationCoefficientView;
+};
+
+}
+
+#endif
@@ -0,0 +1,88 @@
+#include "polynomial_fit_helper.h"
+#include <poincare/matrix.h>
+#include <poincare/multiplication.h>
+#include <assert.h>
+#include <cmath>
+
+using namespace Poincare;
+
+namespace Regression {
+
+namespace PolynomialFitHelper {
+
+void ComputeMoments(const double * x, const double * y, int numberOfPairs, Moments * moments) {
+  moments->numberOfPairs = numberOfPairs;
+  double mean = 0.0;
+  for (int k = 0; k < numberOfPairs; k++) {
+    mean += x[k];
+  }
+  mean = numberOfPairs > 0 ? mean / numberOfPairs : 0.0;
+  double scale = 0.0;
+  for (int k = 0; k < numberOfPairs; k++) {
+    scale = std::fmax(scale, std::fabs(x[k] - mean));
+  }
+  moments->xOffset = mean;
+  moments->xScale = scale > 0.0 ? scale : 1.0;
+  for (int i = 0; i <= 2*k_maxDegree; i++) {
+    moments->powerSums[i] = 0.0;
+  }
+  for (int i = 0; i <= k_maxDegree; i++) {
+    moments->productSums[i] = 0.0;
+  }
+  for (int k = 0; k < numberOfPairs; k++) {
+    double t = (x[k] - moments->xOffset) / moments->xScale;
+    double power = 1.0;
+    for (int i = 0; i <= 2*k_maxDegree; i++) {
+      moments->powerSums[i] += power;
+      if (i <= k_maxDegree) {
+        moments->productSums[i] += power * y[k];
+      }
+      power *= t;
+    }
+  }
+}
+
+bool Fit(const Moments * moments, int degree, double * coefficients) {
+  assert(degree > 0 && degree <= k_maxDegree);
+  const int n = degree + 1;
+  if (moments->numberOfPairs < n) {
+    return false;
+  }
+  // Normal equations: Σt^(i+j)·c_j = Σt^i·y
+  double normalMatrix[(k_maxDegree+1)*(k_maxDegree+1)];
+  double constants[k_maxDegree+1];
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      normalMatrix[i*n+j] = moments->powerSums[i+j];
+    }
+    constants[i] = moments->productSums[i];
+  }
+  if (Matrix::ArrayInverse(normalMatrix, n, n) < 0) {
+    return false;
+  }
+  double tCoefficients[k_maxDegree+1];
+  Multiplication::computeOnArrays<double>(normalMatrix, constants, tCoefficients, n, n, 1);
+  /* Expand Σc_k·((x-m)/s)^k in powers of x:
+   * the coefficient of x^j is Σ_{k≥j} c_k·s^-k·C(k,j)·(-m)^(k-j) */
+  const double m = moments->xOffset;
+  const double s = moments->xScale;
+  for (int j = 0; j < n; j++) {
+    double sum = 0.0;
+    double binomial = 1.0; // C(k,j), starting at k = j
+    for (int k = j; k < n; k++) {
+      sum += tCoefficients[k] * std::pow(s, -k) * binomial * std::pow(-m, k-j);
+      binomial = binomial * (k + 1) / (k + 1 - j);
+    }
+    coefficients[degree - j] = sum;
+  }
+  for (int j = 0; j < n; j++) {
+    if (std::isnan(coefficients[j]) || std::isinf(coefficients[j])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}
+
+}
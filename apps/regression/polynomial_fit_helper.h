@@ -0,0 +1,31 @@
+#ifndef REGRESSION_POLYNOMIAL_FIT_HELPER
+#define REGRESSION_POLYNOMIAL_FIT_HELPER
+
+namespace Regression {
+
+namespace PolynomialFitHelper {
+
+constexpr int k_maxDegree = 4;
+
+/* Sums shared by the least-squares polynomial fits of a series. They are
+ * computed on t = (x - xOffset) / xScale to keep the normal equations well
+ * conditioned, and are enough to fit any degree up to k_maxDegree. */
+struct Moments {
+  int numberOfPairs;
+  double xOffset;
+  double xScale;
+  double powerSums[2*k_maxDegree+1]; // Σt^k
+  double productSums[k_maxDegree+1]; // Σt^k·y
+};
+
+void ComputeMoments(const double * x, const double * y, int numberOfPairs, Moments * moments);
+
+/* Least-squares polynomial of given degree, with coefficients stored by
+ * decreasing powers of x. Returns false if the normal equations are singular. */
+bool Fit(const Moments * moments, int degree, double * coefficients);
+
+}
+
+}
+
+#endif
@@ -1,4 +1,5 @@
 #include "regression_controller.h"
+#include "../apps_container.h"
 #include "model/cubic_model.h"
 #include "model/exponential_model.h"
 #include "model/linear_model.h"
@@ -83,9 +84,18 @@ void RegressionController::willDisplayCellAtLocation(HighlightCell * cell, int i
   assert(i == 0);
   assert(j >= 0 && j < k_numberOfRows);
   I18n::Message messages[k_numberOfRows] = {I18n::Message::Linear, I18n::Message::Proportional, I18n::Message::Quadratic, I18n::Message::Cubic, I18n::Message::Quartic, I18n::Message::Logarithmic, I18n::Message::Exponential, I18n::Message::Power, I18n::Message::Trigonometrical, I18n::Message::Logistic};
-  MessageTableCellWithExpression * castedCell = static_cast<MessageTableCellWithExpression *>(cell);
+  ModelComparisonCell * castedCell = static_cast<ModelComparisonCell *>(cell);
   castedCell->setMessage(messages[j]);
   castedCell->setLayout(m_store->regressionModel((Model::Type) j)->layout());
+  assert(m_series > -1);
+  if (m_store->seriesIsEmpty(m_series)) {
+    castedCell->hideDeterminationCoefficient();
+    return;
+  }
+  /* All the models are fitted at once on the first displayed cell, the other
+   * cells read the memoized comparison. */
+  Poincare::Context * globalContext = AppsContainer::sharedAppsContainer()->globalContext();
+  castedCell->setDeterminationCoefficient(m_store->determinationCoefficientForModel(m_series, (Model::Type) j, globalContext));
 }
 
 }
@@ -1,6 +1,7 @@
 #ifndef REGRESSION_REGRESSION_CONTROLLER_H
 #define REGRESSION_REGRESSION_CONTROLLER_H
 
+#include "model_comparison_cell.h"
 #include "store.h"
 #include <escher.h>
 #include <apps/i18n.h>
@@ -33,7 +34,7 @@ public:
 private:
   constexpr static int k_numberOfRows = 10;
   constexpr static int k_numberOfCells = 6; // (240 - 70) / 35
-  MessageTableCellWithExpression m_regressionCells[k_numberOfCells];
+  ModelComparisonCell m_regressionCells[k_numberOfCells];
   SelectableTableView m_selectableTableView;
   Store * m_store;
   int m_series;
@@ -204,13 +204,17 @@ void Store::updateCoefficients(int series, Poincare::Context * globalContext) {
   }
   if (m_regressionChanged[series] || (m_seriesChecksum[series] != storeChecksumSeries)) {
     Model * seriesModel = modelForSeries(series);
-    seriesModel->fit(this, series, m_regressionCoefficients[series], globalContext);
+    if (modelsComparisonIsValid(series, storeChecksumSeries)) {
+      // All the models were already fitted on this series
+      int type = (int)m_regressionTypes[series];
+      memcpy(m_regressionCoefficients[series], m_comparisonCoefficients[series][type], sizeof(m_regressionCoefficients[series]));
+      m_determinationCoefficient[series] = m_comparisonDeterminationCoefficients[series][type];
+    } else {
+      seriesModel->fit(this, series, m_regressionCoefficients[series], globalContext);
+      m_determinationCoefficient[series] = computeDeterminationCoefficient(series, seriesModel, m_regressionCoefficients[series]);
+    }
     m_regressionChanged[series] = false;
     m_seriesChecksum[series] = storeChecksumSeries;
-    /* m_determinationCoefficient must be updated after m_seriesChecksum and m_regressionChanged
-     * updates to avoid infinite recursive calls as computeDeterminationCoefficient calls
-     * yValueForXValue which calls coefficientsForSeries which calls updateCoefficients */
-    m_determinationCoefficient[series] = computeDeterminationCoefficient(series, globalContext);
   }
 }
 
@@ -226,6 +230,67 @@ double Store::determinationCoefficientForSeries(int series, Poincare::Context *
   return m_determinationCoefficient[series];
 }
 
+double * Store::coefficientsForModel(int series, Model::Type type, Poincare::Context * globalContext) {
+  updateModelsComparison(series, globalContext);
+  return m_comparisonCoefficients[series][(int)type];
+}
+
+double Store::determinationCoefficientForModel(int series, Model::Type type, Poincare::Context * globalContext) {
+  updateModelsComparison(series, globalContext);
+  return m_comparisonDeterminationCoefficients[series][(int)type];
+}
+
+Model::Type Store::bestModelForSeries(int series, Poincare::Context * globalContext) {
+  updateModelsComparison(series, globalContext);
+  int bestIndex = 0;
+  double bestR2 = -INFINITY;
+  for (int i = 0; i < Model::k_numberOfModels; i++) {
+    double r2 = m_comparisonDeterminationCoefficients[series][i];
+    // On equal fits, the simplest model (listed first) is kept
+    if (!std::isnan(r2) && r2 > bestR2) {
+      bestR2 = r2;
+      bestIndex = i;
+    }
+  }
+  return (Model::Type)bestIndex;
+}
+
+bool Store::modelsComparisonIsValid(int series, uint32_t storeChecksumSeries) const {
+  return m_comparisonValid[series]
+    && m_comparisonChecksum[series] == storeChecksumSeries
+    && m_comparisonAngleUnit[series] == Poincare::Preferences::sharedPreferences()->angleUnit();
+}
+
+void Store::updateModelsComparison(int series, Poincare::Context * globalContext) {
+  assert(series >= 0 && series < k_numberOfSeries);
+  assert(!seriesIsEmpty(series));
+  uint32_t storeChecksumSeries = storeChecksumForSeries(series);
+  if (modelsComparisonIsValid(series, storeChecksumSeries)) {
+    return;
+  }
+  Poincare::Preferences::AngleUnit currentAngleUnit = Poincare::Preferences::sharedPreferences()->angleUnit();
+  bool onlyAngleUnitChanged = m_comparisonValid[series] && m_comparisonChecksum[series] == storeChecksumSeries;
+  for (int i = 0; i < Model::k_numberOfModels; i++) {
+    if (onlyAngleUnitChanged && i != (int)Model::Type::Trigonometric) {
+      // Only the trigonometric model depends on the angle unit
+      continue;
+    }
+    Model * model = regressionModel(i);
+    double * coefficients = m_comparisonCoefficients[series][i];
+    if (!m_regressionChanged[series] && (int)m_regressionTypes[series] == i && m_seriesChecksum[series] == storeChecksumSeries && (i != (int)Model::Type::Trigonometric || m_angleUnit == currentAngleUnit)) {
+      // The selected model is already fitted
+      memcpy(coefficients, m_regressionCoefficients[series], sizeof(m_regressionCoefficients[series]));
+      m_comparisonDeterminationCoefficients[series][i] = m_determinationCoefficient[series];
+      continue;
+    }
+    model->fit(this, series, coefficients, globalContext);
+    m_comparisonDeterminationCoefficients[series][i] = computeDeterminationCoefficient(series, model, coefficients);
+  }
+  m_comparisonChecksum[series] = storeChecksumSeries;
+  m_comparisonAngleUnit[series] = currentAngleUnit;
+  m_comparisonValid[series] = true;
+}
+
 double Store::doubleCastedNumberOfPairsOfSeries(int series) const {
   return DoublePairStore::numberOfPairsOfSeries(series);
 }
@@ -235,6 +300,8 @@ void Store::resetMemoization() {
   memset(m_seriesChecksum, 0, sizeof(m_seriesChecksum));
   memset(m_regressionTypes, 0, sizeof(m_regressionTypes));
   memset(m_regressionChanged, 0, sizeof(m_regressionChanged));
+  memset(m_momentsValid, 0, sizeof(m_momentsValid));
+  memset(m_comparisonValid, 0, sizeof(m_comparisonValid));
 }
 
 float Store::maxValueOfColumn(int series, int i) const {
@@ -335,7 +402,17 @@ double Store::correlationCoefficient(int series) const {
   return (v0 == 0.0 || v1 == 0.0) ? 1.0 : covariance(series) / std::sqrt(v0 * v1);
 }
 
-double Store::computeDeterminationCoefficient(int series, Poincare::Context * globalContext) {
+const PolynomialFitHelper::Moments * Store::polynomialMomentsForSeries(int series) {
+  uint32_t storeChecksumSeries = storeChecksumForSeries(series);
+  if (!m_momentsValid[series] || m_momentsChecksum[series] != storeChecksumSeries) {
+    PolynomialFitHelper::ComputeMoments(m_data[series][0], m_data[series][1], numberOfPairsOfSeries(series), &m_polynomialMoments[series]);
+    m_momentsChecksum[series] = storeChecksumSeries;
+    m_momentsValid[series] = true;
+  }
+  return &m_polynomialMoments[series];
+}
+
+double Store::computeDeterminationCoefficient(int series, Model * model, double * coefficients) {
   /* Computes and returns the determination coefficient (R2) of the regression.
    * For linear regressions, it is equal to the square of the correlation
    * coefficient between the series Y and the evaluated values.
@@ -351,7 +428,7 @@ double Store::computeDeterminationCoefficient(int series, Poincare::Context * gl
   const int numberOfPairs = numberOfPairsOfSeries(series);
   for (int k = 0; k < numberOfPairs; k++) {
     // Difference between the observation and the estimated value of the model
-    double evaluation = yValueForXValue(series, m_data[series][0][k], globalContext);
+    double evaluation = model->evaluate(coefficients, m_data[series][0][k]);
     if (std::isnan(evaluation) || std::isinf(evaluation)) {
       // Data Not Suitable for evaluation
       return NAN;
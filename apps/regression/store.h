@@ -12,6 +12,7 @@
 #include "model/quadratic_model.h"
 #include "model/quartic_model.h"
 #include "model/trigonometric_model.h"
+#include "polynomial_fit_helper.h"
 #include "../shared/interactive_curve_view_range.h"
 #include "../shared/double_pair_store.h"
 #include <escher/responder.h>
@@ -73,12 +74,22 @@ public:
   double yValueForXValue(int series, double x, Poincare::Context * globalContext);
   double xValueForYValue(int series, double y, Poincare::Context * globalContext);
   double correlationCoefficient(int series) const; // R
+  const PolynomialFitHelper::Moments * polynomialMomentsForSeries(int series);
+
+  // Models comparison
+  /* All the models are fitted at once on a series and share its moments. The
+   * coefficients and R2 are memoized until the series or angle unit change. */
+  double * coefficientsForModel(int series, Model::Type type, Poincare::Context * globalContext);
+  double determinationCoefficientForModel(int series, Model::Type type, Poincare::Context * globalContext);
+  Model::Type bestModelForSeries(int series, Poincare::Context * globalContext);
 
   // To speed up computation during drawings, float is returned.
   float maxValueOfColumn(int series, int i) const;
   float minValueOfColumn(int series, int i) const;
 private:
-  double computeDeterminationCoefficient(int series, Poincare::Context * globalContext);
+  double computeDeterminationCoefficient(int series, Model * model, double * coefficients);
+  bool modelsComparisonIsValid(int series, uint32_t storeChecksumSeries) const;
+  void updateModelsComparison(int series, Poincare::Context * globalContext);
   constexpr static float k_displayHorizontalMarginRatio = 0.05f;
   void resetMemoization();
   Model * regressionModel(int index);
@@ -98,6 +109,14 @@ private:
   double m_determinationCoefficient[k_numberOfSeries];
   bool m_regressionChanged[k_numberOfSeries];
   Poincare::Preferences::AngleUnit m_angleUnit;
+  PolynomialFitHelper::Moments m_polynomialMoments[k_numberOfSeries];
+  uint32_t m_momentsChecksum[k_numberOfSeries];
+  bool m_momentsValid[k_numberOfSeries];
+  double m_comparisonCoefficients[k_numberOfSeries][Model::k_numberOfModels][Model::k_maxNumberOfCoefficients];
+  double m_comparisonDeterminationCoefficients[k_numberOfSeries][Model::k_numberOfModels];
+  uint32_t m_comparisonChecksum[k_numberOfSeries];
+  bool m_comparisonValid[k_numberOfSeries];
+  Poincare::Preferences::AngleUnit m_comparisonAngleUnit[k_numberOfSeries];
 };
 
 typedef double (Store::*ArgCalculPointer)(int, int, bool) const;
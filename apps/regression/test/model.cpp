@@ -254,6 +254,108 @@ QUIZ_CASE(logistic_regression) {
   // assert_regression_is(x3, y3, 5, Model::Type::Logistic, coefficients3, r23);
 }
 
+// Testing level sets
+
+void assert_level_set_is(Model::Type modelType, double * coefficients, double y, double xMin, double xMax, double trueX) {
+  Regression::Store store;
+  Model * model = store.regressionModel(modelType);
+  double x = model->levelSet(coefficients, xMin, (xMax - xMin) / 100.0, xMax, y, nullptr);
+  quiz_assert((std::isnan(x) && std::isnan(trueX)) || IsApproximatelyEqual(x, trueX, 1e-9, 1e-12));
+  if (!std::isnan(x)) {
+    quiz_assert(IsApproximatelyEqual(model->evaluate(coefficients, x), y, 1e-9, 1e-12));
+  }
+}
+
+QUIZ_CASE(regression_level_set) {
+  // (x-1)(x-3) = x^2-4x+3
+  double quadratic[] = {1.0, -4.0, 3.0};
+  assert_level_set_is(Model::Type::Quadratic, quadratic, 0.0, -10.0, 10.0, 1.0);
+  assert_level_set_is(Model::Type::Quadratic, quadratic, 0.0, 2.0, 10.0, 3.0);
+  assert_level_set_is(Model::Type::Quadratic, quadratic, 0.0, 3.0, 10.0, NAN);
+  assert_level_set_is(Model::Type::Quadratic, quadratic, -1.0, -10.0, 10.0, 2.0);
+  assert_level_set_is(Model::Type::Quadratic, quadratic, -2.0, -10.0, 10.0, NAN);
+  // (x+2)(x-1)(x-5) = x^3-4x^2-7x+10
+  double cubic[] = {1.0, -4.0, -7.0, 10.0};
+  assert_level_set_is(Model::Type::Cubic, cubic, 0.0, -10.0, 10.0, -2.0);
+  assert_level_set_is(Model::Type::Cubic, cubic, 0.0, 0.0, 10.0, 1.0);
+  assert_level_set_is(Model::Type::Cubic, cubic, 0.0, 1.0, 4.0, NAN);
+  double degenerateCubic[] = {0.0, 1.0, -4.0, 3.0};
+  assert_level_set_is(Model::Type::Cubic, degenerateCubic, 0.0, 2.0, 10.0, 3.0);
+  // (x+3)(x+1)(x-2)(x-4) = x^4-2x^3-13x^2+14x+24
+  double quartic[] = {1.0, -2.0, -13.0, 14.0, 24.0};
+  assert_level_set_is(Model::Type::Quartic, quartic, 0.0, -10.0, 10.0, -3.0);
+  assert_level_set_is(Model::Type::Quartic, quartic, 0.0, -2.0, 10.0, -1.0);
+  assert_level_set_is(Model::Type::Quartic, quartic, 0.0, 0.0, 10.0, 2.0);
+  assert_level_set_is(Model::Type::Quartic, quartic, 0.0, 3.0, 10.0, 4.0);
+  // x^4-5x^2+4 = (x^2-1)(x^2-4)
+  double biquadratic[] = {1.0, 0.0, -5.0, 0.0, 4.0};
+  assert_level_set_is(Model::Type::Quartic, biquadratic, 0.0, -1.5, 10.0, -1.0);
+  // x^4 + 1 never reaches 0
+  double positiveQuartic[] = {1.0, 0.0, 0.0, 0.0, 1.0};
+  assert_level_set_is(Model::Type::Quartic, positiveQuartic, 0.0, -10.0, 10.0, NAN);
+  // 2*sin(x+1)+1 in radians
+  Poincare::Preferences::AngleUnit previousAngleUnit = Poincare::Preferences::sharedPreferences()->angleUnit();
+  Poincare::Preferences::sharedPreferences()->setAngleUnit(Poincare::Preferences::AngleUnit::Radian);
+  double trigonometric[] = {2.0, 1.0, 1.0, 1.0};
+  assert_level_set_is(Model::Type::Trigonometric, trigonometric, 1.0, 0.0, 10.0, M_PI - 1.0);
+  assert_level_set_is(Model::Type::Trigonometric, trigonometric, 2.0, -10.0, 10.0, M_PI/6.0 - 1.0 - 2.0 * M_PI);
+  assert_level_set_is(Model::Type::Trigonometric, trigonometric, 4.0, -10.0, 10.0, NAN);
+  Poincare::Preferences::sharedPreferences()->setAngleUnit(previousAngleUnit);
+}
+
+// Testing models comparison
+
+QUIZ_CASE(regression_models_comparison) {
+  // y = 2x^3-x+1 with noise
+  double x[] = {-3.0, -2.0, -1.5, -1.0, 0.0, 0.5, 1.0, 2.0, 2.5, 3.0};
+  double y[] = {-49.93, -13.08, -4.27, 0.04, 1.02, 0.79, 2.07, 14.93, 29.77, 52.08};
+  int numberOfPoints = sizeof(x) / sizeof(double);
+  int series = 0;
+  Regression::Store store;
+  setRegressionPoints(&store, series, numberOfPoints, x, y);
+  Shared::GlobalContext globalContext;
+  RegressionContext context(&store, &globalContext);
+
+  // The batch fit matches the fit of each model selected in turn
+  for (int i = 0; i < Model::k_numberOfModels; i++) {
+    Model::Type type = (Model::Type)i;
+    double comparedR2 = store.determinationCoefficientForModel(series, type, &context);
+    double * comparedCoefficients = store.coefficientsForModel(series, type, &context);
+    Regression::Store referenceStore;
+    setRegressionPoints(&referenceStore, series, numberOfPoints, x, y);
+    referenceStore.setSeriesRegressionType(series, type);
+    double r2 = referenceStore.determinationCoefficientForSeries(series, &context);
+    double * coefficients = referenceStore.coefficientsForSeries(series, &context);
+    quiz_assert((std::isnan(r2) && std::isnan(comparedR2)) || IsApproximatelyEqual(comparedR2, r2, 1e-9, 1e-12));
+    for (int j = 0; j < store.regressionModel(type)->numberOfCoefficients(); j++) {
+      quiz_assert((std::isnan(coefficients[j]) && std::isnan(comparedCoefficients[j])) || IsApproximatelyEqual(comparedCoefficients[j], coefficients[j], 1e-9, 1e-12));
+    }
+  }
+  // Nested polynomial models never fit worse than lower degrees
+  quiz_assert(store.bestModelForSeries(series, &context) == Model::Type::Quartic);
+  double bestR2 = store.determinationCoefficientForModel(series, Model::Type::Quartic, &context);
+  for (int i = 0; i < Model::k_numberOfModels; i++) {
+    double r2 = store.determinationCoefficientForModel(series, (Model::Type)i, &context);
+    quiz_assert(std::isnan(r2) || r2 <= bestR2);
+  }
+
+  // Selecting a model reuses the batch fit
+  store.setSeriesRegressionType(series, Model::Type::Quartic);
+  quiz_assert(store.determinationCoefficientForSeries(series, &context) == store.determinationCoefficientForModel(series, Model::Type::Quartic, &context));
+
+  // The comparison is refreshed when the series changes
+  store.set(-45.0, series, 1, 0);
+  double * quadratic = store.coefficientsForModel(series, Model::Type::Quadratic, &context);
+  Regression::Store referenceStore;
+  setRegressionPoints(&referenceStore, series, numberOfPoints, x, y);
+  referenceStore.set(-45.0, series, 1, 0);
+  referenceStore.setSeriesRegressionType(series, Model::Type::Quadratic);
+  double * referenceQuadratic = referenceStore.coefficientsForSeries(series, &context);
+  for (int j = 0; j < 3; j++) {
+    quiz_assert(IsApproximatelyEqual(quadratic[j], referenceQuadratic[j], 1e-9, 1e-12));
+  }
+}
+
 // Testing column and regression calculation
 
 void assert_column_calculations_is(double * xi, int numberOfPoints, double trueMean, double trueSum, double trueSquaredSum, double trueStandardDeviation, double trueVariance) {
@@ -3,6 +3,8 @@
 
 #include <escher.h>
 #include "../shared/sequence_context.h"
+#include "../shared/sequence_plot_cache.h"
+#include "../shared/sequence_terms_cache.h"
 #include "../shared/sequence_store.h"
 #include "graph/graph_controller.h"
 #include "graph/curve_view_range.h"
@@ -60,6 +62,8 @@ public:
   }
 private:
   App(Snapshot * snapshot);
+  Shared::SequencePlotCache m_sequencePlotCache;
+  Shared::SequenceTermsCache m_sequenceTermsCache;
   Shared::SequenceContext m_sequenceContext;
   ListController m_listController;
   ButtonRowController m_listFooter;
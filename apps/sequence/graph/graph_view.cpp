@@ -1,4 +1,5 @@
 #include "graph_view.h"
+#include "../../shared/sequence_plot_cache.h"
 #include <cmath>
 
 using namespace Shared;
@@ -17,14 +18,25 @@ void GraphView::drawRect(KDContext * ctx, KDRect rect) const {
   /* A dot is drawn at every step where step is larger than 1
    * and than a pixel's width. */
   const int step = std::ceil(pixelWidth());
+  SequenceContext * sqctx = static_cast<SequenceContext *>(context());
+  SequencePlotCache * plotCache = sqctx->plotCache();
+  /* Dots are drawn on ranks which are multiples of step, so that the same
+   * ranks are drawn (and cached) whatever the dirty rect. */
+  float windowXMin = pixelToFloat(Axis::Horizontal, -k_externRectMargin);
+  int windowFirstRank = windowXMin < 0.0f ? 0 : step * static_cast<int>(std::ceil(windowXMin / step));
+  if (plotCache) {
+    plotCache->setRange(windowFirstRank, step);
+  }
+  float rectXMin = pixelToFloat(Axis::Horizontal, rect.left() - k_externRectMargin);
+  rectXMin = rectXMin < 0 ? 0 : rectXMin;
+  float rectXMax = pixelToFloat(Axis::Horizontal, rect.right() + k_externRectMargin);
+  int firstRank = step * static_cast<int>(std::ceil(rectXMin / step));
   for (int i = 0; i < m_sequenceStore->numberOfActiveFunctions(); i++) {
     Ion::Storage::Record record = m_sequenceStore->activeRecordAtIndex(i);
-    Shared::Sequence * s = m_sequenceStore->modelForRecord(record);;
-    float rectXMin = pixelToFloat(Axis::Horizontal, rect.left() - k_externRectMargin);
-    rectXMin = rectXMin < 0 ? 0 : rectXMin;
-    float rectXMax = pixelToFloat(Axis::Horizontal, rect.right() + k_externRectMargin);
-    for (int x = rectXMin; x < rectXMax; x += step) {
-      float y = s->evaluateXYAtParameter((float)x, context()).x2();
+    Shared::Sequence * s = m_sequenceStore->modelForRecord(record);
+    int sequenceIndex = SequenceStore::sequenceIndexForName(s->fullName()[0]);
+    for (int x = firstRank; x < rectXMax; x += step) {
+      float y = plotCache ? plotCache->valueAtRank(s, sequenceIndex, sqctx, x) : s->evaluateXYAtParameter((float)x, sqctx).x2();
       if (std::isnan(y)) {
         continue;
       }
@@ -5,6 +5,8 @@
 #include <cmath>
 #include "../../shared/sequence_store.h"
 #include "../../shared/sequence_context.h"
+#include "../../shared/sequence_plot_cache.h"
+#include "../../shared/sequence_terms_cache.h"
 #include "../../shared/poincare_helpers.h"
 
 using namespace Poincare;
@@ -466,4 +468,92 @@ QUIZ_CASE(sequence_sum_evaluation) {
   check_sum_of_sequence_between_bounds(92.0, 2.0, 7.0, Sequence::Type::DoubleRecurrence, "u(n)+u(n+1)+2", "0", "0");
 }
 
+void check_plot_cache_stays_valid_while_panning(Sequence::Type type, const char * definition, const char * condition1, int step) {
+  Shared::GlobalContext globalContext;
+  SequenceStore * store = globalContext.sequenceStore();
+  SequencePlotCache plotCache;
+  SequenceContext sequenceContext(&globalContext, store, &plotCache);
+  SequenceContext uncachedContext(&globalContext, store);
+
+  Sequence * seq = addSequence(store, type, definition, condition1, nullptr, &globalContext);
+  int firstRank = 0;
+  constexpr int numberOfMoves = 20;
+  for (int i = 0; i < numberOfMoves; i++) {
+    plotCache.setRange(firstRank, step);
+    for (int j = 0; j < SequencePlotCache::k_sizeOfCache; j++) {
+      int rank = firstRank + j * step;
+      float cached = plotCache.valueAtRank(seq, 0, &sequenceContext, rank);
+      float expected = seq->evaluateXYAtParameter(static_cast<float>(rank), &uncachedContext).x2();
+      quiz_assert((std::isnan(cached) && std::isnan(expected)) || cached == expected);
+    }
+    // Alternate large moves to the right and small moves to the left
+    firstRank += (i % 2 == 0 ? 37 : -11) * step;
+    firstRank = firstRank < 0 ? 0 : firstRank;
+  }
+
+  store->removeAll();
+  store->tidy(); // Cf comment above
+}
+
+QUIZ_CASE(sequence_plot_caching) {
+  check_plot_cache_stays_valid_while_panning(Sequence::Type::Explicit, "n^2", nullptr, 1);
+  check_plot_cache_stays_valid_while_panning(Sequence::Type::Explicit, "1/n", nullptr, 3);
+  check_plot_cache_stays_valid_while_panning(Sequence::Type::SingleRecurrence, "u(n)+n", "1", 1);
+  check_plot_cache_stays_valid_while_panning(Sequence::Type::SingleRecurrence, "0.5u(n)+1", "0", 7);
+}
+
+QUIZ_CASE(sequence_plot_caching_undefined_terms) {
+  Shared::GlobalContext globalContext;
+  SequenceStore * store = globalContext.sequenceStore();
+  SequencePlotCache plotCache;
+  SequenceContext sequenceContext(&globalContext, store, &plotCache);
+
+  Sequence * seq = addSequence(store, Sequence::Type::Explicit, "1/0", nullptr, nullptr, &globalContext);
+  plotCache.setRange(0, 1);
+  quiz_assert(std::isnan(plotCache.valueAtRank(seq, 0, &sequenceContext, 5)));
+  /* An undefined term is computed once: it is read back from the cache even
+   * though the sequence now has a defined value at this rank. */
+  seq->setContent("n", &globalContext);
+  quiz_assert(std::isnan(plotCache.valueAtRank(seq, 0, &sequenceContext, 5)));
+  sequenceContext.resetCache();
+  quiz_assert(plotCache.valueAtRank(seq, 0, &sequenceContext, 5) == 5.0f);
+
+  store->removeAll();
+  store->tidy(); // Cf comment above
+}
+
+void check_terms_cache_matches_uncached_evaluation(Sequence::Type type, const char * definition, const char * condition1, const char * condition2) {
+  Shared::GlobalContext globalContext;
+  SequenceStore * store = globalContext.sequenceStore();
+  SequenceTermsCache termsCache;
+  SequenceContext sequenceContext(&globalContext, store, nullptr, &termsCache);
+  SequenceContext uncachedContext(&globalContext, store);
+
+  Sequence * seq = addSequence(store, type, definition, condition1, condition2, &globalContext);
+  // Tabulate, jump forward and backward across blocks
+  int ranks[] = {0, 1, 2, 3, 50, 63, 64, 65, 200, 199, 150, 120, 1000, 5, -1};
+  for (int rank : ranks) {
+    double cached = seq->evaluateXYAtParameter(static_cast<double>(rank), &sequenceContext).x2();
+    double expected = seq->evaluateXYAtParameter(static_cast<double>(rank), &uncachedContext).x2();
+    quiz_assert((std::isnan(cached) && std::isnan(expected)) || cached == expected);
+  }
+  // Sums are extended or restarted as the bounds move
+  int bounds[][2] = {{0, 10}, {0, 150}, {0, 149}, {3, 300}, {3, 301}, {10, 5}};
+  for (int i = 0; i < static_cast<int>(sizeof(bounds)/sizeof(bounds[0])); i++) {
+    double cached = PoincareHelpers::ApproximateToScalar<double>(seq->sumBetweenBounds(bounds[i][0], bounds[i][1], &sequenceContext), &globalContext);
+    double expected = PoincareHelpers::ApproximateToScalar<double>(seq->sumBetweenBounds(bounds[i][0], bounds[i][1], &uncachedContext), &globalContext);
+    quiz_assert((std::isnan(cached) && std::isnan(expected)) || cached == expected);
+  }
+
+  store->removeAll();
+  store->tidy(); // Cf comment above
+}
+
+QUIZ_CASE(sequence_terms_caching) {
+  check_terms_cache_matches_uncached_evaluation(Sequence::Type::Explicit, "n^2", nullptr, nullptr);
+  check_terms_cache_matches_uncached_evaluation(Sequence::Type::Explicit, "1/(n-2)", nullptr, nullptr);
+  check_terms_cache_matches_uncached_evaluation(Sequence::Type::SingleRecurrence, "0.5u(n)+1", "0", nullptr);
+  check_terms_cache_matches_uncached_evaluation(Sequence::Type::DoubleRecurrence, "u(n)+u(n+1)", "1", "1");
+}
+
 }
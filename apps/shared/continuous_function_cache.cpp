@@ -6,7 +6,6 @@ namespace Shared {
 
 constexpr int ContinuousFunctionCache::k_sizeOfCache;
 constexpr float ContinuousFunctionCache::k_cacheHitTolerance;
-constexpr int ContinuousFunctionCache::k_numberOfAvailableCaches;
 
 // public
 void ContinuousFunctionCache::PrepareForCaching(void * fun, ContinuousFunctionCache * cache, float tMin, float tStep) {
@@ -15,7 +14,7 @@ void ContinuousFunctionCache::PrepareForCaching(void * fun, ContinuousFunctionCa
   if (!cache) {
     /* ContinuousFunctionStore::cacheAtIndex has returned a nullptr : the index
      * of the function we are trying to draw is greater than the number of
-     * available caches, so we just tell the function to not lookup any cache. */
+     * caches fitting in the memory budget, so we just tell the function to not lookup any cache. */
     function->setCache(nullptr);
     return;
   }
@@ -35,8 +34,14 @@ void ContinuousFunctionCache::PrepareForCaching(void * fun, ContinuousFunctionCa
     cache->clear();
   }
 
-  if (function->plotType() == ContinuousFunction::PlotType::Cartesian && tStep != 0) {
-    function->cache()->pan(function, tMin);
+  if (function->plotType() == ContinuousFunction::PlotType::Cartesian) {
+    if (tStep != 0) {
+      function->cache()->pan(function, tMin);
+    }
+  } else if (tMin != cache->m_tMin) {
+    /* Non cartesian caches do not depend on the window, so they are kept while
+     * panning. They are only dropped if the range of t has moved. */
+    cache->clear();
   }
   function->cache()->setRange(function, tMin, tStep);
 }
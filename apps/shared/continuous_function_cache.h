@@ -12,11 +12,13 @@ class ContinuousFunction;
 
 class ContinuousFunctionCache {
 public:
-  static constexpr int k_numberOfAvailableCaches = 2;
+  /* The size of the cache is chosen to optimize the display of cartesian
+   * functions */
+  static constexpr int k_sizeOfCache = Ion::Display::Width;
 
   static void PrepareForCaching(void * fun, ContinuousFunctionCache * cache, float tMin, float tStep);
 
-  ContinuousFunctionCache() { clear(); }
+  ContinuousFunctionCache() : m_tMin(0.0f) { clear(); }
 
   float step() const { return m_tStep; }
   void clear();
@@ -24,9 +26,6 @@ public:
   // Sets step parameters for non-cartesian curves
   static void ComputeNonCartesianSteps(float * tStep, float * tCacheStep, float tMax, float tMin);
 private:
-  /* The size of the cache is chosen to optimize the display of cartesian
-   * functions */
-  static constexpr int k_sizeOfCache = Ion::Display::Width;
   /* We need a certain amount of tolerance since we try to evaluate the
    * equality of floats. But the value has to be chosen carefully. Too high of
    * a tolerance causes false positives, which lead to errors in curves
@@ -47,7 +46,8 @@ private:
   float m_cache[k_sizeOfCache];
   /* m_startOfCache is used to implement a circular buffer for easy panning
    * with cartesian functions. When dealing with parametric or polar functions,
-   * m_startOfCache should be zero.*/
+   * m_startOfCache should be zero: their cache is indexed on the function's
+   * own t range, which does not move when the window is panned. */
   int m_startOfCache;
 };
 
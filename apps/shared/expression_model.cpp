@@ -1,6 +1,7 @@
 #include "expression_model.h"
 #include "global_context.h"
 #include "poincare_helpers.h"
+#include "reduced_expression_cache.h"
 #include <apps/apps_container.h>
 #include <poincare/horizontal_layout.h>
 #include <poincare/undefined.h>
@@ -69,6 +70,13 @@ Expression ExpressionModel::expressionReduced(const Storage::Record * record, Po
    */
   if (m_expression.isUninitialized()) {
     assert(record->fullName() != nullptr);
+    /* The reduced expression outlives the model in the storage, as long as
+     * nothing it might depend on changes. */
+    uint32_t dependenciesChecksum = ReducedExpressionCache::DependenciesChecksum();
+    m_expression = ReducedExpressionCache::ExpressionForRecord(record, indexInRecord(), dependenciesChecksum);
+    if (!m_expression.isUninitialized()) {
+      return m_expression;
+    }
     if (isCircularlyDefined(record, context)) {
       m_expression = Undefined::Builder();
     } else {
@@ -79,10 +87,12 @@ Expression ExpressionModel::expressionReduced(const Storage::Record * record, Po
       Expression tempExpression = m_expression.clone();
       PoincareHelpers::Simplify(&tempExpression, context, ExpressionNode::ReductionTarget::SystemForApproximation);
       // simplify might return an uninitialized Expression if interrupted
-      if (!tempExpression.isUninitialized()) {
-        m_expression = tempExpression;
+      if (tempExpression.isUninitialized()) {
+        return m_expression;
       }
+      m_expression = tempExpression;
     }
+    ReducedExpressionCache::SetExpressionForRecord(m_expression, record, indexInRecord(), dependenciesChecksum);
   }
   return m_expression;
 }
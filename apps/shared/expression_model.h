@@ -32,6 +32,8 @@ private:
   virtual void updateNewDataWithExpression(Ion::Storage::Record * record, const Poincare::Expression & expressionToStore, void * expressionAddress, size_t expressionToStoreSize, size_t previousExpressionSize);
   virtual void * expressionAddress(const Ion::Storage::Record * record) const = 0;
   virtual size_t expressionSize(const Ion::Storage::Record * record) const = 0;
+  // Tells apart the expressions stored in a same record
+  virtual int indexInRecord() const { return 0; }
   bool isCircularlyDefined(const Ion::Storage::Record * record, Poincare::Context * context) const;
   mutable int8_t m_circular;
 };
@@ -0,0 +1,113 @@
+#include "reduced_expression_cache.h"
+#include "global_context.h"
+#include <apps/global_preferences.h>
+#include <poincare/preferences.h>
+#include <ion.h>
+#include <assert.h>
+#include <string.h>
+
+using namespace Poincare;
+
+namespace Shared {
+
+uint32_t ReducedExpressionCache::DependenciesChecksum() {
+  Preferences * preferences = Preferences::sharedPreferences();
+  const char * patchLevel = Ion::patchLevel();
+  uint32_t checksums[3] = {
+    static_cast<uint32_t>(preferences->angleUnit())
+    | static_cast<uint32_t>(preferences->complexFormat()) << 8
+    | static_cast<uint32_t>(GlobalPreferences::sharedGlobalPreferences()->unitFormat()) << 16,
+    Ion::Storage::sharedStorage()->checksumOfRecordsWithExtensions(GlobalContext::k_extensions, GlobalContext::k_numberOfExtensions),
+    Ion::crc32Byte(reinterpret_cast<const uint8_t *>(patchLevel), strlen(patchLevel))
+  };
+  return Ion::crc32Word(checksums, 3);
+}
+
+Expression ReducedExpressionCache::ExpressionForRecord(const Ion::Storage::Record * record, int index, uint32_t checksum) {
+  uint16_t size;
+  const char * address = ExpressionAddress(CacheRecord().value(), record->fullName(), index, checksum, &size);
+  if (address == nullptr) {
+    return Expression();
+  }
+  return Expression::ExpressionFromAddress(address, size);
+}
+
+void ReducedExpressionCache::SetExpressionForRecord(const Expression & expression, const Ion::Storage::Record * record, int index, uint32_t checksum) {
+  assert(!expression.isUninitialized());
+  assert(index >= 0 && index <= UINT8_MAX);
+  Ion::Storage * storage = Ion::Storage::sharedStorage();
+  Ion::Storage::Record cacheRecord = CacheRecord();
+  size_t expressionSize = expression.size();
+  size_t entrySize = strlen(record->fullName()) + 1 + sizeof(uint8_t) + sizeof(uint16_t) + expressionSize;
+  // Account for the creation of the record, even if it already exists
+  size_t requiredSize = sizeof(Ion::Storage::record_size_t) + strlen(k_recordBaseName) + 1 + strlen(Ion::Storage::cacheExtension) + 1 + sizeof(checksum) + entrySize + k_minimalAvailableSize;
+  if (storage->availableSize() < requiredSize) {
+    return;
+  }
+  Ion::Storage::Record::Data data = cacheRecord.value();
+  uint16_t size;
+  bool entriesAreCorrupted = false;
+  if (ExpressionAddress(data, record->fullName(), index, checksum, &size, &entriesAreCorrupted) != nullptr) {
+    return;
+  }
+  if (data.buffer == nullptr || data.size < sizeof(checksum) || memcmp(data.buffer, &checksum, sizeof(checksum)) != 0 || entriesAreCorrupted) {
+    // Discard the entries reduced with other definitions or that cannot be read
+    Ion::Storage::Record::ErrorStatus error = data.buffer == nullptr ?
+      storage->createRecordWithExtension(k_recordBaseName, Ion::Storage::cacheExtension, &checksum, sizeof(checksum)) :
+      cacheRecord.setValue({.buffer = &checksum, .size = sizeof(checksum)});
+    if (error != Ion::Storage::Record::ErrorStatus::None) {
+      return;
+    }
+    data = cacheRecord.value();
+  }
+  size_t previousSize = data.size;
+  data.size += entrySize;
+  if (cacheRecord.setValue(data) != Ion::Storage::Record::ErrorStatus::None) {
+    return;
+  }
+  /* Growing the cache record may have moved the record of the expression, so
+   * its name is read again. */
+  char * entry = static_cast<char *>(const_cast<void *>(cacheRecord.value().buffer)) + previousSize;
+  const char * fullName = record->fullName();
+  size_t fullNameSize = strlen(fullName) + 1;
+  memcpy(entry, fullName, fullNameSize);
+  entry += fullNameSize;
+  *entry++ = static_cast<uint8_t>(index);
+  size = expressionSize;
+  memcpy(entry, &size, sizeof(size));
+  entry += sizeof(size);
+  memcpy(entry, expression.addressInPool(), expressionSize);
+}
+
+const char * ReducedExpressionCache::ExpressionAddress(Ion::Storage::Record::Data data, const char * fullName, int index, uint32_t checksum, uint16_t * size, bool * entriesAreCorrupted) {
+  if (data.buffer == nullptr || fullName == nullptr || data.size < sizeof(checksum) || memcmp(data.buffer, &checksum, sizeof(checksum)) != 0) {
+    return nullptr;
+  }
+  const char * entry = static_cast<const char *>(data.buffer) + sizeof(checksum);
+  const char * end = static_cast<const char *>(data.buffer) + data.size;
+  while (entry < end) {
+    // A truncated or corrupted entry ends the lookup
+    const char * entryNameEnd = static_cast<const char *>(memchr(entry, 0, end - entry));
+    bool entryFits = entryNameEnd != nullptr && static_cast<size_t>(end - entryNameEnd) >= 1 + sizeof(uint8_t) + sizeof(uint16_t);
+    const char * expressionAddress = nullptr;
+    if (entryFits) {
+      expressionAddress = entryNameEnd + 1 + sizeof(uint8_t) + sizeof(uint16_t);
+      // Sizes are not aligned in the record
+      memcpy(size, entryNameEnd + 1 + sizeof(uint8_t), sizeof(uint16_t));
+      entryFits = *size > 0 && *size <= end - expressionAddress;
+    }
+    if (!entryFits) {
+      if (entriesAreCorrupted != nullptr) {
+        *entriesAreCorrupted = true;
+      }
+      return nullptr;
+    }
+    if (static_cast<uint8_t>(entryNameEnd[1]) == index && strcmp(entry, fullName) == 0) {
+      return expressionAddress;
+    }
+    entry = expressionAddress + *size;
+  }
+  return nullptr;
+}
+
+}
@@ -0,0 +1,42 @@
+#ifndef SHARED_REDUCED_EXPRESSION_CACHE_H
+#define SHARED_REDUCED_EXPRESSION_CACHE_H
+
+#include <poincare/expression.h>
+#include <ion/storage.h>
+
+namespace Shared {
+
+/* The reduced expressions of functions and sequences are kept in a record of
+ * the storage, so that they are not simplified again each time an app is
+ * entered. The record is laid out as:
+ * | Checksum | FullName1 | Index1 | Size1 | Expression1 | FullName2 | ...
+ * where FullName is the name of the record defining the expression and Index
+ * tells apart the expressions of a same record (the definition and the
+ * initial conditions of a sequence).
+ * The checksum covers all the records defining symbols, functions and
+ * sequences, the preferences used by the reduction and the build of the
+ * software, since the expressions hold pointers to virtual tables. When any of
+ * them changes, all the entries are discarded at once. Entries are checked to
+ * fit in the record before they are read, and are discarded as well if they
+ * do not.
+ * The record has the cache extension, which hides it from Python. */
+
+class ReducedExpressionCache {
+public:
+  static uint32_t DependenciesChecksum();
+  static Poincare::Expression ExpressionForRecord(const Ion::Storage::Record * record, int index, uint32_t checksum);
+  static void SetExpressionForRecord(const Poincare::Expression & expression, const Ion::Storage::Record * record, int index, uint32_t checksum);
+  static bool IsCacheRecord(const Ion::Storage::Record record) { return record == CacheRecord(); }
+private:
+  static constexpr const char * k_recordBaseName = "reduced";
+  static Ion::Storage::Record CacheRecord() { return Ion::Storage::Record(k_recordBaseName, Ion::Storage::cacheExtension); }
+  /* The cache only uses space that is not likely to be claimed soon by the
+   * user, since its entries are never evicted to make room for new records. */
+  constexpr static size_t k_minimalAvailableSize = Ion::Storage::k_storageSize / 4;
+  // entriesAreCorrupted, if not null, tells whether the lookup hit an entry that does not fit
+  static const char * ExpressionAddress(Ion::Storage::Record::Data data, const char * fullName, int index, uint32_t checksum, uint16_t * size, bool * entriesAreCorrupted = nullptr);
+};
+
+}
+
+#endif
@@ -1,6 +1,7 @@
 #include "sequence.h"
 #include "sequence_cache_context.h"
 #include "sequence_store.h"
+#include "sequence_terms_cache.h"
 #include <poincare/layout_helper.h>
 #include <poincare/serialization_helper.h>
 #include <poincare/code_point_layout.h>
@@ -14,6 +15,7 @@
 #include <string.h>
 #include <apps/i18n.h>
 #include <cmath>
+#include <limits.h>
 
 using namespace Poincare;
 
@@ -167,6 +169,17 @@ bool Sequence::badlyReferencesItself(Context * context) {
     return value;
 }
 
+Coordinate2D<double> Sequence::evaluateXYAtParameter(double x, Poincare::Context * context) const {
+  SequenceContext * sqctx = static_cast<SequenceContext *>(context);
+  SequenceTermsCache * termsCache = sqctx->termsCache();
+  double n = std::round(x);
+  if (termsCache != nullptr && n <= INT_MAX) {
+    int sequenceIndex = SequenceStore::sequenceIndexForName(fullName()[0]);
+    return Coordinate2D<double>(x, termsCache->termAtRank(sequenceIndex, n < 0.0 ? -1 : static_cast<int>(n), sqctx));
+  }
+  return Coordinate2D<double>(x, templatedApproximateAtAbscissa(x, sqctx));
+}
+
 template<typename T>
 T Sequence::templatedApproximateAtAbscissa(T x, SequenceContext * sqctx) const {
   T n = std::round(x);
@@ -248,7 +261,7 @@ T Sequence::approximateToNextRank(int n, SequenceContext * sqctx, int sequenceIn
     {
       for (int i = 0; i < MaxNumberOfSequences; i++) {
         // Set in context u(n) = u(n) for all sequences
-        ctx.setValueForSymbol(values[i][0], symbols[i][0]);
+        ctx.setValueForSequenceRank(values[i][0], i, 0);
       }
       return PoincareHelpers::ApproximateWithValueForSymbol(expressionReduced(sqctx), unknownN, (T)n, &ctx);
     }
@@ -259,8 +272,8 @@ T Sequence::approximateToNextRank(int n, SequenceContext * sqctx, int sequenceIn
       }
       for (int i = 0; i < MaxNumberOfSequences; i++) {
         // Set in context u(n) = u(n-1) and u(n+1) = u(n) for all sequences
-        ctx.setValueForSymbol(values[i][0], symbols[i][1]);
-        ctx.setValueForSymbol(values[i][1], symbols[i][0]);
+        ctx.setValueForSequenceRank(values[i][0], i, 1);
+        ctx.setValueForSequenceRank(values[i][1], i, 0);
       }
       return PoincareHelpers::ApproximateWithValueForSymbol(expressionReduced(sqctx), unknownN, (T)(n-1), &ctx);
     }
@@ -274,8 +287,8 @@ T Sequence::approximateToNextRank(int n, SequenceContext * sqctx, int sequenceIn
       }
       for (int i = 0; i < MaxNumberOfSequences; i++) {
         // Set in context u(n) = u(n-2) and u(n+1) = u(n-1) for all sequences
-        ctx.setValueForSymbol(values[i][1], symbols[i][1]);
-        ctx.setValueForSymbol(values[i][2], symbols[i][0]);
+        ctx.setValueForSequenceRank(values[i][1], i, 1);
+        ctx.setValueForSequenceRank(values[i][2], i, 0);
       }
       return PoincareHelpers::ApproximateWithValueForSymbol(expressionReduced(sqctx), unknownN, (T)(n-2), &ctx);
     }
@@ -292,6 +305,11 @@ Expression Sequence::sumBetweenBounds(double start, double end, Poincare::Contex
   }
   start = std::round(start);
   end = std::round(end);
+  SequenceTermsCache * termsCache = static_cast<SequenceContext *>(context)->termsCache();
+  if (termsCache != nullptr && start >= 0.0 && end <= INT_MAX) {
+    int sequenceIndex = SequenceStore::sequenceIndexForName(fullName()[0]);
+    return Float<double>::Builder(termsCache->sumBetweenRanks(sequenceIndex, start, end, static_cast<SequenceContext *>(context)));
+  }
   for (double i = start; i <= end; i = i + 1.0) {
     /* When |start| >> 1.0, start + 1.0 = start. In that case, quit the
      * infinite loop. */
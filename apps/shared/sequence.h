@@ -65,9 +65,7 @@ public:
   Poincare::Coordinate2D<float> evaluateXYAtParameter(float x, Poincare::Context * context) const override {
     return Poincare::Coordinate2D<float>(x, templatedApproximateAtAbscissa(x, static_cast<SequenceContext *>(context)));
   }
-  Poincare::Coordinate2D<double> evaluateXYAtParameter(double x, Poincare::Context * context) const override {
-    return Poincare::Coordinate2D<double>(x,templatedApproximateAtAbscissa(x, static_cast<SequenceContext *>(context)));
-  }
+  Poincare::Coordinate2D<double> evaluateXYAtParameter(double x, Poincare::Context * context) const override;
   template<typename T> T approximateToNextRank(int n, SequenceContext * sqctx, int sequenceIndex = -1) const;
   template<typename T> T valueAtRank(int n, SequenceContext * sqctx);
 
@@ -141,6 +139,7 @@ private:
     void updateMetaData(const Ion::Storage::Record * record, size_t newSize) override;
     void * expressionAddress(const Ion::Storage::Record * record) const override;
     size_t expressionSize(const Ion::Storage::Record * record) const override;
+    int indexInRecord() const override { return conditionIndex() + 1; }
     void buildName(Sequence * sequence) override;
     virtual int conditionIndex() const = 0;
   };
@@ -3,7 +3,6 @@
 #include "sequence_store.h"
 #include "poincare_helpers.h"
 #include <poincare/serialization_helper.h>
-#include <poincare/addition.h>
 #include <poincare/rational.h>
 #include <cmath>
 
@@ -19,17 +18,32 @@ SequenceCacheContext<T>::SequenceCacheContext(SequenceContext * sequenceContext)
 {
 }
 
+static bool isUnknownN(Expression e) {
+  return e.type() == ExpressionNode::Type::Symbol && static_cast<Symbol &>(e).isSystemSymbol();
+}
+
+static bool isOne(Expression e) {
+  return e.type() == ExpressionNode::Type::Rational && static_cast<Rational &>(e).isOne();
+}
+
 template<typename T>
 const Expression SequenceCacheContext<T>::expressionForSymbolAbstract(const Poincare::SymbolAbstract & symbol, bool clone, float unknownSymbolValue ) {
   // [u|v|w](n(+1)?)
   if (symbol.type() == ExpressionNode::Type::Sequence) {
     int index = nameIndexForSymbol(const_cast<Symbol &>(static_cast<const Symbol &>(symbol)));
-    Expression rank = symbol.childAtIndex(0).clone();
-    if (rank.isIdenticalTo(Symbol::Builder(UCodePointUnknown))) {
+    /* This is called for each term of the sequences: u(n) and u(n+1) are
+     * recognized without building expressions to compare them with. */
+    Expression rank = symbol.childAtIndex(0);
+    if (isUnknownN(rank)) {
       return Float<T>::Builder(m_values[index][0]);
-    } if (rank.isIdenticalTo(Addition::Builder(Symbol::Builder(UCodePointUnknown), Rational::Builder(1)))) {
+    }
+    if (rank.type() == ExpressionNode::Type::Addition
+        && rank.numberOfChildren() == 2
+        && isUnknownN(rank.childAtIndex(0))
+        && isOne(rank.childAtIndex(1))) {
       return Float<T>::Builder(m_values[index][1]);
     }
+    rank = rank.clone();
     Ion::Storage::Record record = m_sequenceContext->sequenceStore()->recordAtIndex(index);
     if (!record.isNull()) {
       Sequence * seq = m_sequenceContext->sequenceStore()->modelForRecord(record);
@@ -51,11 +65,6 @@ const Expression SequenceCacheContext<T>::expressionForSymbolAbstract(const Poin
   return ContextWithParent::expressionForSymbolAbstract(symbol, clone);
 }
 
-template<typename T>
-void SequenceCacheContext<T>::setValueForSymbol(T value, const Poincare::Symbol & symbol) {
-  m_values[nameIndexForSymbol(symbol)][rankIndexForSymbol(symbol)] = value;
-}
-
 template<typename T>
 int SequenceCacheContext<T>::nameIndexForSymbol(const Poincare::Symbol & symbol) {
   assert(symbol.name()[0] >= 'u' && symbol.name()[0] <= 'w'); //  [u|v|w]
@@ -13,7 +13,13 @@ class SequenceCacheContext : public Poincare::ContextWithParent {
 public:
   SequenceCacheContext(SequenceContext * sequenceContext);
   const Poincare::Expression expressionForSymbolAbstract(const Poincare::SymbolAbstract & symbol, bool clone, float unknownSymbolValue = NAN) override;
-  void setValueForSymbol(T value, const Poincare::Symbol & symbol);
+  void setValueForSymbol(T value, const Poincare::Symbol & symbol) {
+    setValueForSequenceRank(value, nameIndexForSymbol(symbol), rankIndexForSymbol(symbol));
+  }
+  // rankIndex is 0 for u(n) and 1 for u(n+1)
+  void setValueForSequenceRank(T value, int nameIndex, int rankIndex) {
+    m_values[nameIndex][rankIndex] = value;
+  }
 private:
   int nameIndexForSymbol(const Poincare::Symbol & symbol);
   int rankIndexForSymbol(const Poincare::Symbol & symbol);
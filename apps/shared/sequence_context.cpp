@@ -1,6 +1,8 @@
 #include "sequence_context.h"
 #include "sequence_store.h"
 #include "sequence_cache_context.h"
+#include "sequence_plot_cache.h"
+#include "sequence_terms_cache.h"
 #include "../shared/poincare_helpers.h"
 #include <cmath>
 
@@ -118,6 +120,17 @@ void TemplatedSequenceContext<T>::step(SequenceContext * sqctx, int sequenceInde
   }
 }
 
+void SequenceContext::resetCache() {
+  m_floatSequenceContext.resetCache();
+  m_doubleSequenceContext.resetCache();
+  if (m_plotCache) {
+    m_plotCache->clear();
+  }
+  if (m_termsCache) {
+    m_termsCache->clear();
+  }
+}
+
 template class TemplatedSequenceContext<float>;
 template class TemplatedSequenceContext<double>;
 template void * SequenceContext::helper<float>();
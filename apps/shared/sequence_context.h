@@ -12,6 +12,8 @@ static constexpr int MaxNumberOfSequences = 3;
 
 class SequenceStore;
 class SequenceContext;
+class SequencePlotCache;
+class SequenceTermsCache;
 
 template<typename T>
 class TemplatedSequenceContext {
@@ -55,11 +57,15 @@ private:
 
 class SequenceContext : public Poincare::ContextWithParent {
 public:
-  SequenceContext(Poincare::Context * parentContext, SequenceStore * sequenceStore) :
+  /* The plot and terms caches are optional: SequenceContexts are sometimes
+   * built on the stack, where caches of computed values would not fit. */
+  SequenceContext(Poincare::Context * parentContext, SequenceStore * sequenceStore, SequencePlotCache * plotCache = nullptr, SequenceTermsCache * termsCache = nullptr) :
     ContextWithParent(parentContext),
     m_floatSequenceContext(),
     m_doubleSequenceContext(),
-    m_sequenceStore(sequenceStore) {}
+    m_sequenceStore(sequenceStore),
+    m_plotCache(plotCache),
+    m_termsCache(termsCache) {}
   /* expressionForSymbolAbstract & setExpressionForSymbolAbstractName directly call the parent
    * context respective methods. Indeed, special chars like n, u(n), u(n+1),
    * v(n), v(n+1) are taken into accound only when evaluating sequences which
@@ -68,10 +74,7 @@ public:
     return static_cast<TemplatedSequenceContext<T>*>(helper<T>())->valueOfCommonRankSequenceAtPreviousRank(sequenceIndex, rank);
   }
 
-  void resetCache() {
-    m_floatSequenceContext.resetCache();
-    m_doubleSequenceContext.resetCache();
-  }
+  void resetCache();
 
   template<typename T> bool iterateUntilRank(int n) {
     return static_cast<TemplatedSequenceContext<T>*>(helper<T>())->iterateUntilRank(n, m_sequenceStore, this);
@@ -97,10 +100,14 @@ public:
     static_cast<TemplatedSequenceContext<T>*>(helper<T>())->step(this, sequenceIndex);
   }
   SequenceStore * sequenceStore() { return m_sequenceStore; }
+  SequencePlotCache * plotCache() { return m_plotCache; }
+  SequenceTermsCache * termsCache() { return m_termsCache; }
 private:
   TemplatedSequenceContext<float> m_floatSequenceContext;
   TemplatedSequenceContext<double> m_doubleSequenceContext;
   SequenceStore * m_sequenceStore;
+  SequencePlotCache * m_plotCache;
+  SequenceTermsCache * m_termsCache;
   template<typename T> void * helper() { return sizeof(T) == sizeof(float) ? (void*) &m_floatSequenceContext : (void*) &m_doubleSequenceContext; }
 };
 
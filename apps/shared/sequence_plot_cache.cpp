@@ -0,0 +1,77 @@
+#include "sequence_plot_cache.h"
+#include "sequence.h"
+
+namespace Shared {
+
+constexpr size_t SequencePlotCache::k_memoryBudget;
+constexpr int SequencePlotCache::k_sizeOfCache;
+constexpr int SequencePlotCache::k_numberOfValidityWords;
+
+void SequencePlotCache::clear() {
+  m_startOfCache = 0;
+  invalidateBetween(0, k_sizeOfCache);
+}
+
+void SequencePlotCache::setRange(int firstRank, int step) {
+  assert(step > 0);
+  if (step != m_step) {
+    m_step = step;
+    m_firstRank = firstRank;
+    clear();
+    return;
+  }
+  int delta = firstRank - m_firstRank;
+  m_firstRank = firstRank;
+  if (delta == 0) {
+    return;
+  }
+  if (delta % step != 0 || delta / step >= k_sizeOfCache || delta / step <= -k_sizeOfCache) {
+    clear();
+    return;
+  }
+  int dI = delta / step;
+  int oldStart = m_startOfCache;
+  m_startOfCache = (m_startOfCache + dI) % k_sizeOfCache;
+  if (m_startOfCache < 0) {
+    m_startOfCache += k_sizeOfCache;
+  }
+  if (dI > 0) {
+    if (m_startOfCache > oldStart) {
+      invalidateBetween(oldStart, m_startOfCache);
+    } else {
+      invalidateBetween(oldStart, k_sizeOfCache);
+      invalidateBetween(0, m_startOfCache);
+    }
+  } else {
+    if (m_startOfCache > oldStart) {
+      invalidateBetween(m_startOfCache, k_sizeOfCache);
+      invalidateBetween(0, oldStart);
+    } else {
+      invalidateBetween(m_startOfCache, oldStart);
+    }
+  }
+}
+
+float SequencePlotCache::valueAtRank(const Sequence * sequence, int sequenceIndex, SequenceContext * sqctx, int rank) {
+  assert(sequenceIndex >= 0 && sequenceIndex < MaxNumberOfSequences);
+  int delta = rank - m_firstRank;
+  if (m_step <= 0 || delta < 0 || delta % m_step != 0 || delta / m_step >= k_sizeOfCache) {
+    return sequence->evaluateXYAtParameter(static_cast<float>(rank), sqctx).x2();
+  }
+  int i = (delta / m_step + m_startOfCache) % k_sizeOfCache;
+  if (!isValid(sequenceIndex, i)) {
+    m_values[sequenceIndex][i] = sequence->evaluateXYAtParameter(static_cast<float>(rank), sqctx).x2();
+    setValid(sequenceIndex, i);
+  }
+  return m_values[sequenceIndex][i];
+}
+
+void SequencePlotCache::invalidateBetween(int iInf, int iSup) {
+  for (int s = 0; s < MaxNumberOfSequences; s++) {
+    for (int i = iInf; i < iSup; i++) {
+      m_validity[s][i / 32] &= ~(1u << (i % 32));
+    }
+  }
+}
+
+}
@@ -0,0 +1,46 @@
+#ifndef SHARED_SEQUENCE_PLOT_CACHE_H
+#define SHARED_SEQUENCE_PLOT_CACHE_H
+
+#include "sequence_context.h"
+#include <ion/display.h>
+
+namespace Shared {
+
+class Sequence;
+
+/* SequencePlotCache memoizes the float values of the sequences on a window of
+ * ranks, so that redrawing the graph does not evaluate every rank of the
+ * visible range again. Ranks are sampled every m_step, starting at
+ * m_firstRank. As for ContinuousFunctionCache, the values are stored in
+ * circular buffers to keep them when the window is panned. */
+
+class SequencePlotCache {
+public:
+  /* The whole cache is bounded by k_memoryBudget, shared evenly between the
+   * sequences. */
+  constexpr static size_t k_memoryBudget = MaxNumberOfSequences * Ion::Display::Width * sizeof(float);
+  constexpr static int k_sizeOfCache = k_memoryBudget / (MaxNumberOfSequences * sizeof(float));
+
+  SequencePlotCache() : m_firstRank(0), m_step(0) { clear(); }
+  void clear();
+  /* Sets the sampled ranks: firstRank, firstRank + step, ... Values which are
+   * still in the window are kept. */
+  void setRange(int firstRank, int step);
+  float valueAtRank(const Sequence * sequence, int sequenceIndex, SequenceContext * sqctx, int rank);
+private:
+  /* Undefined terms are NAN, so whether a value was computed is kept apart,
+   * one bit per value. */
+  constexpr static int k_numberOfValidityWords = (k_sizeOfCache + 31) / 32;
+  bool isValid(int sequenceIndex, int i) const { return m_validity[sequenceIndex][i / 32] & (1u << (i % 32)); }
+  void setValid(int sequenceIndex, int i) { m_validity[sequenceIndex][i / 32] |= 1u << (i % 32); }
+  void invalidateBetween(int iInf, int iSup);
+  int m_firstRank;
+  int m_step;
+  int m_startOfCache;
+  float m_values[MaxNumberOfSequences][k_sizeOfCache];
+  uint32_t m_validity[MaxNumberOfSequences][k_numberOfValidityWords];
+};
+
+}
+
+#endif
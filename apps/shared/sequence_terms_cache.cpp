@@ -0,0 +1,60 @@
+#include "sequence_terms_cache.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Shared {
+
+constexpr int SequenceTermsCache::k_numberOfTerms;
+
+void SequenceTermsCache::clear() {
+  m_firstRank = 0;
+  m_numberOfComputedTerms = 0;
+  for (int i = 0; i < MaxNumberOfSequences; i++) {
+    m_sumStart[i] = -1;
+    m_sumEnd[i] = -1;
+    m_sum[i] = 0.0;
+  }
+}
+
+double SequenceTermsCache::termAtRank(int sequenceIndex, int rank, SequenceContext * sqctx) {
+  assert(sequenceIndex >= 0 && sequenceIndex < MaxNumberOfSequences);
+  if (rank < 0) {
+    return NAN;
+  }
+  int endRank = m_firstRank + m_numberOfComputedTerms;
+  if (rank < m_firstRank || rank >= m_firstRank + k_numberOfTerms) {
+    /* Move the block so that it contains rank. Ranks preceding rank are kept
+     * in the block to go back without iterating from the first rank again,
+     * unless they would have to be computed for that sole purpose. */
+    m_firstRank = std::max(0, rank - k_numberOfTerms/2);
+    if (rank >= endRank) {
+      m_firstRank = std::max(m_firstRank, endRank);
+    }
+    m_numberOfComputedTerms = 0;
+  }
+  while (m_firstRank + m_numberOfComputedTerms <= rank) {
+    // All the sequences are stepped at once to the next rank
+    bool iterated = sqctx->iterateUntilRank<double>(m_firstRank + m_numberOfComputedTerms);
+    for (int i = 0; i < MaxNumberOfSequences; i++) {
+      m_terms[i][m_numberOfComputedTerms] = iterated ? sqctx->valueOfCommonRankSequenceAtPreviousRank<double>(i, 0) : NAN;
+    }
+    m_numberOfComputedTerms++;
+  }
+  return m_terms[sequenceIndex][rank - m_firstRank];
+}
+
+double SequenceTermsCache::sumBetweenRanks(int sequenceIndex, int start, int end, SequenceContext * sqctx) {
+  assert(sequenceIndex >= 0 && sequenceIndex < MaxNumberOfSequences);
+  if (m_sumStart[sequenceIndex] != start || m_sumEnd[sequenceIndex] > end) {
+    m_sumStart[sequenceIndex] = start;
+    m_sumEnd[sequenceIndex] = start - 1;
+    m_sum[sequenceIndex] = 0.0;
+  }
+  while (m_sumEnd[sequenceIndex] < end) {
+    m_sumEnd[sequenceIndex]++;
+    m_sum[sequenceIndex] += termAtRank(sequenceIndex, m_sumEnd[sequenceIndex], sqctx);
+  }
+  return m_sum[sequenceIndex];
+}
+
+}
@@ -0,0 +1,35 @@
+#ifndef SHARED_SEQUENCE_TERMS_CACHE_H
+#define SHARED_SEQUENCE_TERMS_CACHE_H
+
+#include "sequence_context.h"
+
+namespace Shared {
+
+/* SequenceTermsCache memoizes the double values of all the sequences on a
+ * block of consecutive ranks. The block is filled in one pass, stepping the
+ * recurrences of all the sequences at once, and is shared by the values table,
+ * the graph cursor and the sum tool. Sums starting at the same rank are
+ * extended term by term, so that summing or tabulating consecutive ranks is
+ * linear in the range. */
+
+class SequenceTermsCache {
+public:
+  constexpr static int k_numberOfTerms = 64;
+
+  SequenceTermsCache() { clear(); }
+  void clear();
+  double termAtRank(int sequenceIndex, int rank, SequenceContext * sqctx);
+  double sumBetweenRanks(int sequenceIndex, int start, int end, SequenceContext * sqctx);
+private:
+  int m_firstRank;
+  int m_numberOfComputedTerms;
+  double m_terms[MaxNumberOfSequences][k_numberOfTerms];
+  // Last sums, from m_sumStart to m_sumEnd
+  int m_sumStart[MaxNumberOfSequences];
+  int m_sumEnd[MaxNumberOfSequences];
+  double m_sum[MaxNumberOfSequences];
+};
+
+}
+
+#endif
@@ -5,6 +5,7 @@
 #include "../global_preferences.h"
 #include <limits.h>
 
+#include <poincare/complex.h>
 #include <poincare/constant.h>
 #include <poincare/symbol.h>
 #include <poincare/matrix.h>
@@ -134,11 +135,12 @@ EquationStore::Error EquationStore::exactSolve(Poincare::Context * context, bool
  * 2) We look for classic forms of equations for which we have algorithms
  * that output the exact answer. If one is recognized in the input equation,
  * the exact answer is given to the user.
- * 3) If no classic form has been found in the developped form, we need to use
- * numerical approximation. Therefore, to prevent precision losses, we work
- * with the undevelopped form of the equation. Therefore we set reductionTarget
- * to SystemForApproximation. Solutions are then numericaly approximated
- * between the bounds provided by the user. */
+ * 3) If the equation is a polynomial of higher degree with real coefficients,
+ * all its roots are approximated at once, whatever their location.
+ * 4) Otherwise, we need to use numerical approximation. Therefore, to prevent
+ * precision losses, we work with the undevelopped form of the equation.
+ * Therefore we set reductionTarget to SystemForApproximation. Solutions are
+ * then numericaly approximated between the bounds provided by the user. */
 
 EquationStore::Error EquationStore::privateExactSolve(Poincare::Context * context, bool replaceFunctionsButNotSymbols) {
   tidySolution();
@@ -246,11 +248,19 @@ EquationStore::Error EquationStore::privateExactSolve(Poincare::Context * contex
       m_type = Type::PolynomialMonovariable;
       error = oneDimensialPolynomialSolve(exactSolutions, exactSolutionsApproximations, polynomialCoefficients, degree, context);
     } else {
-      // Step 4. Monovariable non-polynomial or polynomial with degree > 2
-      m_type = Type::Monovariable;
-      m_intervalApproximateSolutions[0] = -10;
-      m_intervalApproximateSolutions[1] = 10;
-      return Error::RequireApproximateSolution;
+      double approximateCoefficients[k_maxApproximatePolynomialDegree+1];
+      degree = approximatePolynomialCoefficients(simplifiedExpressions[0], approximateCoefficients, context);
+      if (degree > Expression::k_maxPolynomialDegree) {
+        // Step 4. Polynomial with degree > 2
+        m_type = Type::ApproximatePolynomialMonovariable;
+        error = approximatePolynomialSolve(exactSolutions, exactSolutionsApproximations, approximateCoefficients, degree, context);
+      } else {
+        // Step 5. Monovariable non-polynomial or polynomial with degree > 10
+        m_type = Type::Monovariable;
+        m_intervalApproximateSolutions[0] = -10;
+        m_intervalApproximateSolutions[1] = 10;
+        return Error::RequireApproximateSolution;
+      }
     }
   }
   // Create the results' layouts
@@ -340,6 +350,83 @@ EquationStore::Error EquationStore::resolveLinearSystem(Expression exactSolution
   return Error::NoError;
 }
 
+/* MonomialDegree returns k if e is c*symbol^k with c independent of symbol,
+ * and -1 otherwise. */
+static int MonomialDegree(const Expression & e, const char * symbol, Context * context) {
+  int degree = e.polynomialDegree(context, symbol);
+  if (degree <= 0) {
+    return degree;
+  }
+  if (e.type() == ExpressionNode::Type::Symbol
+      || (e.type() == ExpressionNode::Type::Power && e.childAtIndex(0).type() == ExpressionNode::Type::Symbol))
+  {
+    // The symbol is the only one e depends on.
+    return degree;
+  }
+  if (e.type() == ExpressionNode::Type::Multiplication) {
+    int monomialDegree = 0;
+    for (int i = 0; i < e.numberOfChildren(); i++) {
+      int factorDegree = MonomialDegree(e.childAtIndex(i), symbol, context);
+      if (factorDegree < 0) {
+        return -1;
+      }
+      monomialDegree += factorDegree;
+    }
+    return monomialDegree;
+  }
+  return -1;
+}
+
+int EquationStore::approximatePolynomialCoefficients(const Expression & e, double coefficients[k_maxApproximatePolynomialDegree+1], Context * context) {
+  /* The equation was developed by its reduction, so a polynomial is a sum of
+   * monomials. The coefficient of each monomial c*x^k is its value at x = 1. */
+  const char * symbol = m_variables[0];
+  int degree = e.polynomialDegree(context, symbol);
+  if (degree < 0 || degree > k_maxApproximatePolynomialDegree) {
+    return -1;
+  }
+  for (int i = 0; i <= degree; i++) {
+    coefficients[i] = 0.0;
+  }
+  bool isSum = e.type() == ExpressionNode::Type::Addition;
+  int numberOfTerms = isSum ? e.numberOfChildren() : 1;
+  for (int i = 0; i < numberOfTerms; i++) {
+    Expression term = isSum ? e.childAtIndex(i) : e;
+    int termDegree = MonomialDegree(term, symbol, context);
+    if (termDegree < 0) {
+      return -1;
+    }
+    double coefficient = term.approximateWithValueForSymbol<double>(symbol, 1.0, context, Preferences::ComplexFormat::Real, Preferences::sharedPreferences()->angleUnit());
+    if (!std::isfinite(coefficient)) {
+      // The coefficient is complex or undefined
+      return -1;
+    }
+    coefficients[termDegree] += coefficient;
+  }
+  return degree;
+}
+
+EquationStore::Error EquationStore::approximatePolynomialSolve(Expression exactSolutions[k_maxNumberOfExactSolutions], Expression exactSolutionsApproximations[k_maxNumberOfExactSolutions], const double coefficients[k_maxApproximatePolynomialDegree+1], int degree, Context * context) {
+  std::complex<double> roots[k_maxApproximatePolynomialDegree];
+  int numberOfRoots = Poincare::Solver::PolynomialRoots(coefficients, degree, roots);
+  if (numberOfRoots < 0) {
+    return Error::EquationUndefined;
+  }
+  Preferences::ComplexFormat complexFormat = updatedComplexFormat(context);
+  m_numberOfSolutions = 0;
+  for (int i = 0; i < numberOfRoots; i++) {
+    if (complexFormat == Preferences::ComplexFormat::Real && roots[i].imag() != 0.0) {
+      continue;
+    }
+    /* The solutions only have an approximate value, which is displayed on its
+     * own as exact and approximate layouts are identical. */
+    exactSolutions[m_numberOfSolutions] = Complex<double>::Builder(roots[i]).complexToExpression(complexFormat);
+    exactSolutionsApproximations[m_numberOfSolutions] = exactSolutions[m_numberOfSolutions].clone();
+    m_numberOfSolutions++;
+  }
+  return Error::NoError;
+}
+
 EquationStore::Error EquationStore::oneDimensialPolynomialSolve(Expression exactSolutions[k_maxNumberOfExactSolutions], Expression exactSolutionsApproximations[k_maxNumberOfExactSolutions], Expression coefficients[Expression::k_maxNumberOfPolynomialCoefficients], int degree, Context * context) {
   /* Equation ax^2+bx+c = 0 */
   assert(degree == 2);
@@ -3,6 +3,7 @@
 
 #include "equation.h"
 #include "../shared/expression_model_store.h"
+#include <poincare/solver.h>
 #include <poincare/symbol_abstract.h>
 #include <stdint.h>
 
@@ -13,6 +14,7 @@ public:
   enum class Type {
     LinearSystem,
     PolynomialMonovariable,
+    ApproximatePolynomialMonovariable,
     Monovariable,
   };
   enum class Error : int16_t {
@@ -83,8 +85,13 @@ public:
 
   void tidy() override;
 
-  static constexpr int k_maxNumberOfExactSolutions = Poincare::Expression::k_maxNumberOfVariables > Poincare::Expression::k_maxPolynomialDegree + 1? Poincare::Expression::k_maxNumberOfVariables : Poincare::Expression::k_maxPolynomialDegree + 1;
   static constexpr int k_maxNumberOfApproximateSolutions = 10;
+  /* Polynomials of degree higher than Expression::k_maxPolynomialDegree have
+   * all their roots approximated at once, up to this degree. */
+  static constexpr int k_maxApproximatePolynomialDegree = k_maxNumberOfApproximateSolutions;
+  static_assert(k_maxApproximatePolynomialDegree <= Poincare::Solver::k_maxPolynomialRootsDegree, "Poincare::Solver cannot approximate the roots of polynomials of such a degree");
+  static constexpr int k_maxNumberOfExactSolutionsOfSystems = Poincare::Expression::k_maxNumberOfVariables > Poincare::Expression::k_maxPolynomialDegree + 1? Poincare::Expression::k_maxNumberOfVariables : Poincare::Expression::k_maxPolynomialDegree + 1;
+  static constexpr int k_maxNumberOfExactSolutions = k_maxNumberOfExactSolutionsOfSystems > k_maxApproximatePolynomialDegree ? k_maxNumberOfExactSolutionsOfSystems : k_maxApproximatePolynomialDegree;
   bool m_hasMoreThanMaxNumberOfApproximateSolution;
   static constexpr int k_maxNumberOfSolutions = k_maxNumberOfExactSolutions > k_maxNumberOfApproximateSolutions ? k_maxNumberOfExactSolutions : k_maxNumberOfApproximateSolutions;
 private:
@@ -100,6 +107,8 @@ private:
 
   Error privateExactSolve(Poincare::Context * context, bool replaceFunctionsButNotSymbols);
   Error resolveLinearSystem(Poincare::Expression solutions[k_maxNumberOfExactSolutions], Poincare::Expression solutionApproximations[k_maxNumberOfExactSolutions], Poincare::Expression coefficients[k_maxNumberOfEquations][Poincare::Expression::k_maxNumberOfVariables], Poincare::Expression constants[k_maxNumberOfEquations], Poincare::Context * context);
+  int approximatePolynomialCoefficients(const Poincare::Expression & e, double coefficients[k_maxApproximatePolynomialDegree+1], Poincare::Context * context);
+  Error approximatePolynomialSolve(Poincare::Expression solutions[k_maxNumberOfExactSolutions], Poincare::Expression solutionApproximations[k_maxNumberOfExactSolutions], const double coefficients[k_maxApproximatePolynomialDegree+1], int degree, Poincare::Context * context);
   Error oneDimensialPolynomialSolve(Poincare::Expression solutions[k_maxNumberOfExactSolutions], Poincare::Expression solutionApproximations[k_maxNumberOfExactSolutions], Poincare::Expression polynomialCoefficients[Poincare::Expression::k_maxNumberOfPolynomialCoefficients], int degree, Poincare::Context * context);
   void tidySolution();
   bool isExplictlyComplex(Poincare::Context * context);
@@ -110,7 +119,7 @@ private:
   char m_variables[Poincare::Expression::k_maxNumberOfVariables][Poincare::SymbolAbstract::k_maxNameSize];
   char m_userVariables[Poincare::Expression::k_maxNumberOfVariables][Poincare::SymbolAbstract::k_maxNameSize];
   int m_numberOfSolutions;
-  Poincare::Layout m_exactSolutionExactLayouts[k_maxNumberOfApproximateSolutions];
+  Poincare::Layout m_exactSolutionExactLayouts[k_maxNumberOfExactSolutions];
   Poincare::Layout m_exactSolutionApproximateLayouts[k_maxNumberOfExactSolutions];
   bool m_exactSolutionIdentity[k_maxNumberOfExactSolutions];
   bool m_exactSolutionEquality[k_maxNumberOfExactSolutions];
@@ -100,7 +100,7 @@ SolutionsController::SolutionsController(Responder * parentResponder, EquationSt
 
 /* ViewController */
 const char * SolutionsController::title() {
-  if (m_equationStore->type() == EquationStore::Type::Monovariable) {
+  if (m_equationStore->type() == EquationStore::Type::Monovariable || m_equationStore->type() == EquationStore::Type::ApproximatePolynomialMonovariable) {
     return I18n::translate(I18n::Message::ApproximateSolution);
   }
   return I18n::translate(I18n::Message::Solution);
@@ -128,7 +128,7 @@ void SolutionsController::viewDidDisappear() {
 
 void SolutionsController::didEnterResponderChain(Responder * previousFirstResponder) {
   // Select the most left present subview on all cells and reinitialize scroll
-  for (int i = 0; i < EquationStore::k_maxNumberOfExactSolutions; i++) {
+  for (int i = 0; i < k_numberOfExactValueCells; i++) {
     m_exactValueCells[i].reinitSelection();
   }
 }
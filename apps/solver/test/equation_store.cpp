@@ -93,8 +93,12 @@ QUIZ_CASE(equation_solve) {
   assert_solves_to_error("conj(x)*x+1=0", RequireApproximateSolution);
   assert_solves_numerically_to("conj(x)*x+1=0", -100, 100, {});
 
-  assert_solves_to_error("(x-10)^7=0", RequireApproximateSolution);
-  assert_solves_numerically_to("(x-10)^7=0", -100, 100, {10});
+  // Polynomials of higher degree have all their roots approximated at once
+  assert_solves_to("(x-10)^7=0", "x=10");
+  assert_solves_to("x^4-5x^2+4=0", {"x=-2", "x=-1", "x=1", "x=2"});
+  assert_solves_to("x^3-3x-2=0", {"x=-1", "x=2"});
+  assert_solves_to("x^5=x^4", {"x=0", "x=1"});
+  assert_solves_to("(x-100)(x+100)(x-1)(x-1.5)=0", {"x=-100", "x=1", "x=1.5", "x=100"});
 }
 
 
@@ -106,6 +110,12 @@ QUIZ_CASE(equation_solve_complex_real) {
   assert_solves_to_error("x^2-√(-1)=0", EquationUnreal);
   assert_solves_to_error("x+√(-1)×√(-1)=0", EquationUnreal);
   assert_solves_to("root(-8,3)*x+3=0", "x=3/2");
+  assert_solves_to("x^4-1=0", {"x=-1", "x=1"});
+  assert_solves_to_no_solution("x^4+1=0");
+  // Ill conditioned real roots are not dropped as complex ones
+  assert_solves_to("(x-1)(x-2)(x-3)(x-4)(x-5)(x-6)(x-7)(x-8)(x-9)(x-10)=0", {"x=1", "x=2", "x=3", "x=4", "x=5", "x=6", "x=7", "x=8", "x=9", "x=10"});
+  assert_solves_to("(x-3)^7(x+1)(x-2)(x-5)=0", {"x=-1", "x=2", "x=3", "x=5"});
+  assert_solves_to("(x-3)^7(x^2+1)(x-5)=0", {"x=3", "x=5"});
   reset_complex_format();
 }
 
@@ -117,6 +127,7 @@ QUIZ_CASE(equation_solve_complex_cartesian) {
   assert_solves_to("x^2-√(-1)=0", {"x=-√(2)/2-(√(2)/2)𝐢", "x=√(2)/2+(√(2)/2)𝐢", "delta=4𝐢"});
   assert_solves_to("x+√(-1)×√(-1)=0", "x=1");
   assert_solves_to("root(-8,3)*x+3=0", "x=-3/4+(3√(3)/4)*𝐢");
+  assert_solves_to("x^4-1=0", {"x=-1", "x=-𝐢", "x=𝐢", "x=1"});
   reset_complex_format();
 }
 
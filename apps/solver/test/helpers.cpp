@@ -69,7 +69,7 @@ void assert_solves_to(std::initializer_list<const char *> equations, std::initia
       *equal = 0;
 
       const char * expectedVariable = editableSolution;
-      if (store->type() != EquationStore::Type::PolynomialMonovariable) {
+      if (store->type() != EquationStore::Type::PolynomialMonovariable && store->type() != EquationStore::Type::ApproximatePolynomialMonovariable) {
         /* For some reason the EquationStore returns up to 3 results but always
          * just one variable, so we don't check variable name...
          * TODO: Change this poor behavior. */
@@ -7,6 +7,7 @@ ifdef OMEGA_USERNAME
 endif
 SFLAGS += -DEPSILON_GETOPT=$(EPSILON_GETOPT)
 SFLAGS += -DEPSILON_TELEMETRY=$(EPSILON_TELEMETRY)
+SFLAGS += -DEPSILON_PROFILE=$(EPSILON_PROFILE)
 SFLAGS += -DESCHER_LOG_EVENTS_BINARY=$(ESCHER_LOG_EVENTS_BINARY)
 
 # Language-specific flags
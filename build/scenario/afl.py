@@ -6,7 +6,8 @@ NUMBER_OF_FUZZERS=multiprocessing.cpu_count()
 
 def afl_command(name):
   master_option = "-M" if name.startswith("master") else "-S"
-  return ["afl-fuzz", "-t", "10000", "-i", "scenari", "-o", "afl_out", master_option, "epsilon-fuzz-" + name, "./epsilon.bin"]
+  # epsilon.headless.bin boots once, then replays each input in a forked child
+  return ["afl-fuzz", "-t", "10000", "-i", "scenari", "-o", "afl_out", master_option, "epsilon-fuzz-" + name, "./epsilon.headless.bin", "--fuzz"]
 
 def run_afl(commands, name):
   # Launch the fuzzer
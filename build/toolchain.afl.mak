@@ -1,7 +1,9 @@
 export AFL_QUIET = 1
-CC = afl-clang
-CXX = afl-clang++
-LD = afl-clang++
+# The LLVM mode of AFL provides the deferred and persistent modes used by the
+# --fuzz option of epsilon.headless.bin
+CC = afl-clang-fast
+CXX = afl-clang-fast++
+LD = afl-clang-fast++
 
 ifeq ($(ASAN),1)
 export AFL_USE_ASAN = 1
@@ -10,6 +10,7 @@ public:
   void setState(bool state) { m_stateView.setState(state); }
   KDSize minimalSizeForOptimalDisplay() const override;
   void drawRect(KDContext * ctx, KDRect rect) const override;
+  KDRect opaqueRect() const override { return bounds(); }
 private:
   // Dot right margin.
   constexpr static KDCoordinate k_stateMargin = 9;
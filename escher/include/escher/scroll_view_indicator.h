@@ -55,6 +55,7 @@ public:
   bool update(bool visible);
   void setBackgroundColor(KDColor c) { m_backgroundColor = c; }
   void drawRect(KDContext * ctx, KDRect rect) const override;
+  KDRect opaqueRect() const override { return bounds(); }
 private:
   bool m_visible;
   const char m_arrow;
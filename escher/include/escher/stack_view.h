@@ -9,6 +9,7 @@ class StackView : public View, public Bordered {
 public:
   StackView();
   void drawRect(KDContext * ctx, KDRect rect) const override;
+  KDRect opaqueRect() const override { return bounds(); }
   void setNamedController(ViewController * controller);
   void setTextColor(KDColor textColor);
   void setBackgroundColor(KDColor backgroundColor);
@@ -22,6 +22,7 @@ public:
   virtual View * accessoryView() const;
   virtual View * subAccessoryView() const;
   void drawRect(KDContext * ctx, KDRect rect) const override;
+  KDRect opaqueRect() const override { return bounds(); }
 protected:
   virtual KDColor backgroundColor() const { return KDColorWhite; }
   virtual KDCoordinate labelMargin() const { return k_horizontalMargin; }
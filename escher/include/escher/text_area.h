@@ -26,12 +26,15 @@ protected:
   public:
     Text(char * buffer, size_t bufferSize) :
       m_buffer(buffer),
-      m_bufferSize(bufferSize)
+      m_bufferSize(bufferSize),
+      m_lineWidthsFont(nullptr)
     {
+      rebuildLineIndex();
     }
     void setText(char * buffer, size_t bufferSize) {
       m_buffer = buffer;
       m_bufferSize = bufferSize;
+      rebuildLineIndex();
     }
     const char * text() const { return m_buffer; }
 
@@ -95,11 +98,34 @@ protected:
       return strlen(m_buffer);
     }
     int textLineTotal() const {
-      return positionAtPointer(m_buffer+textLength()).line();
+      return numberOfLines() - 1;
     }
+
+    int numberOfLines() const;
+    Line lineAtIndex(int index) const;
+    KDCoordinate lineWidthAtIndex(int index, const KDFont * const font) const;
+
+    /* The buffer must not be edited without notifying the line index: the
+     * text between start and previousEnd has been replaced by the text between
+     * start and newEnd. */
+    void updateLineIndex(const char * start, const char * previousEnd, const char * newEnd);
   private:
+    /* Line index: the offsets of the line starts and the memoized line widths
+     * are updated on each edit, so that drawing and moving the cursor only
+     * depend on the lines involved, not on the length of the text. Texts with
+     * more lines than the index can hold are scanned from their beginning. */
+    constexpr static int k_lineIndexSize = 1000;
+    constexpr static KDCoordinate k_unknownLineWidth = -1;
+    void rebuildLineIndex();
+    bool lineIndexIsValid() const { return m_numberOfIndexedLines > 0; }
+    int lineIndexAtPointer(const char * pointer) const;
+
     char * m_buffer;
     size_t m_bufferSize;
+    uint16_t m_lineStarts[k_lineIndexSize];
+    mutable KDCoordinate m_lineWidths[k_lineIndexSize];
+    mutable const KDFont * m_lineWidthsFont;
+    int m_numberOfIndexedLines;
   };
 
   class ContentView : public TextInput::ContentView {
@@ -120,6 +146,7 @@ protected:
     const char * editedText() const override { return m_text.text(); }
     size_t editedTextLength() const override { return m_text.textLength(); }
     const Text * getText() const { return &m_text; }
+    void updateLineIndex(const char * start, const char * previousEnd, const char * newEnd) { m_text.updateLineIndex(start, previousEnd, newEnd); }
     bool insertTextAtLocation(const char * text, char * location, int textLength = -1) override;
     void moveCursorGeo(int deltaX, int deltaY);
     bool removePreviousGlyph() override;
@@ -62,6 +62,7 @@ protected:
     KDColor backgroundColor() const { return m_backgroundColor; }
     void setTextColor(KDColor textColor);
     void drawRect(KDContext * ctx, KDRect rect) const override;
+    KDRect opaqueRect() const override { return bounds(); }
     bool isEditing() const { return m_isEditing; }
     const char * text() const override;
     const char * editedText() const override;
@@ -20,6 +20,7 @@ public:
     m_backgroundColor(backgroundColor)
   {}
   void drawRect(KDContext * ctx, KDRect rect) const override;
+  KDRect opaqueRect() const override { return text() == nullptr ? KDRectZero : bounds(); }
   void setBackgroundColor(KDColor backgroundColor);
   void setTextColor(KDColor textColor);
   void setAlignment(float horizontalAlignment, float verticalAlignment);
@@ -45,6 +45,11 @@ public:
   virtual void drawRect(KDContext * ctx, KDRect rect) const {
     // By default, a view doesn't do anything, it's transparent
   }
+  /* The opaque rect, in the view's coordinates, is a region of which drawRect
+   * paints every pixel lying in the rect it is asked to draw. The superview
+   * does not paint the pixels it covers. It must be kept in sync with
+   * drawRect: when in doubt, a view is transparent. */
+  virtual KDRect opaqueRect() const { return KDRectZero; }
 
   void setSize(KDSize size);
   void setFrame(KDRect frame, bool force);
@@ -80,6 +85,12 @@ private:
   virtual void layoutSubviews(bool force = false) {}
   virtual const Window * window() const;
   KDRect redraw(KDRect rect, KDRect forceRedrawRect = KDRectZero);
+  /* Splits rect into the parts that are not covered by the opaque rects of the
+   * subviews. A subview whose opaque rect would split rect into more than
+   * k_maxNumberOfRectsToDraw parts is ignored, since each part costs a call to
+   * drawRect. */
+  constexpr static int k_maxNumberOfRectsToDraw = 4;
+  int rectsNotCoveredBySubviews(KDRect rect, KDRect rects[k_maxNumberOfRectsToDraw]);
   KDPoint absoluteOrigin() const;
   KDRect absoluteVisibleFrame() const;
 
@@ -1,4 +1,5 @@
 #include <escher/container.h>
+#include <ion/profiler.h>
 #include <assert.h>
 
 Container::Container() :
@@ -44,7 +45,12 @@ bool Container::dispatchEvent(Ion::Events::Event event) {
     window()->redraw();
     return true;
   }
-  if (s_activeApp->processEvent(event)) {
+  bool didProcessEvent;
+  {
+    Ion::Profiler::PhaseScope profilerScope(Ion::Profiler::Phase::EventHandling);
+    didProcessEvent = s_activeApp->processEvent(event);
+  }
+  if (didProcessEvent) {
     window()->redraw();
     return true;
   }
@@ -1,5 +1,6 @@
 #include <escher/run_loop.h>
 #include <kandinsky/font.h>
+#include <ion/profiler.h>
 #include <assert.h>
 
 RunLoop::RunLoop() :
@@ -48,6 +49,7 @@ bool RunLoop::step() {
     for (int i=0; i<numberOfTimers(); i++) {
       Timer * timer = timerAtIndex(i);
       if (timer->tick()) {
+        Ion::Profiler::EventScope profilerScope(Ion::Events::TimerFire);
         dispatchEvent(Ion::Events::TimerFire);
       }
     }
@@ -70,6 +72,7 @@ bool RunLoop::step() {
       return true;
     }
 #endif
+    Ion::Profiler::EventScope profilerScope(event);
     dispatchEvent(event);
   }
 
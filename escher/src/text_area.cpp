@@ -152,6 +152,13 @@ bool TextArea::handleEventWithText(const char * text, bool indentation, bool for
   // Remove the Empty code points
   UTF8Helper::RemoveCodePoint(insertionPosition, UCodePointEmpty, &cursorPositionInCommand, endOfInsertedText);
 
+  // The indentation and the removed code points edited the inserted text
+  int editedTextLengthDelta = contentView()->getText()->textLength() - (previousTextLength + addedTextLength);
+  if (indentation || editedTextLengthDelta != 0) {
+    const char * previousEndOfInsertedText = insertionPosition + addedTextLength;
+    contentView()->updateLineIndex(insertionPosition, previousEndOfInsertedText, previousEndOfInsertedText + editedTextLengthDelta);
+  }
+
   // Set the cursor location
   const char * nextCursorLocation = forceCursorRightOfText ? endOfInsertedText : cursorPositionInCommand;
   setCursorLocation(nextCursorLocation);
@@ -286,30 +293,153 @@ const char * TextArea::Text::pointerAtPosition(Position p) {
   if (p.line() < 0) {
     return m_buffer;
   }
-  int y = 0;
-  for (Line l : *this) {
-    if (p.line() == y) {
-      const char * result = UTF8Helper::CodePointAtGlyphOffset(l.text(), p.column());
-      return std::min(result, l.text() + l.charLength());
-    }
-    y++;
+  if (p.line() >= numberOfLines()) {
+    return m_buffer + strlen(m_buffer);
   }
-  return m_buffer + strlen(m_buffer);
+  Line l = lineAtIndex(p.line());
+  const char * result = UTF8Helper::CodePointAtGlyphOffset(l.text(), p.column());
+  return std::min(result, l.text() + l.charLength());
 }
 
 TextArea::Text::Position TextArea::Text::positionAtPointer(const char * p) const {
   assert(m_buffer != nullptr);
   assert(m_buffer <= p && p < m_buffer + m_bufferSize);
-  size_t y = 0;
-  for (Line l : *this) {
-    if (l.contains(p)) {
-      size_t x = UTF8Helper::GlyphOffsetAtCodePoint(l.text(), p);
-      return Position(x, y);
+  int y = lineIndexAtPointer(p);
+  Line l = lineAtIndex(y);
+  assert(l.contains(p));
+  size_t x = UTF8Helper::GlyphOffsetAtCodePoint(l.text(), p);
+  return Position(x, y);
+}
+
+int TextArea::Text::numberOfLines() const {
+  if (lineIndexIsValid()) {
+    return m_numberOfIndexedLines;
+  }
+  assert(m_buffer != nullptr);
+  return UTF8Helper::CountOccurrences(m_buffer, '\n') + 1;
+}
+
+TextArea::Text::Line TextArea::Text::lineAtIndex(int index) const {
+  assert(index >= 0 && index < numberOfLines());
+  if (lineIndexIsValid()) {
+    return Line(m_buffer + m_lineStarts[index]);
+  }
+  LineIterator it = begin();
+  for (int i = 0; i < index; i++) {
+    ++it;
+  }
+  return *it;
+}
+
+KDCoordinate TextArea::Text::lineWidthAtIndex(int index, const KDFont * const font) const {
+  if (!lineIndexIsValid()) {
+    return lineAtIndex(index).glyphWidth(font);
+  }
+  assert(index >= 0 && index < m_numberOfIndexedLines);
+  if (font != m_lineWidthsFont) {
+    for (int i = 0; i < m_numberOfIndexedLines; i++) {
+      m_lineWidths[i] = k_unknownLineWidth;
     }
-    y++;
+    m_lineWidthsFont = font;
   }
-  assert(false);
-  return Position(0, 0);
+  if (m_lineWidths[index] == k_unknownLineWidth) {
+    m_lineWidths[index] = lineAtIndex(index).glyphWidth(font);
+  }
+  return m_lineWidths[index];
+}
+
+int TextArea::Text::lineIndexAtPointer(const char * pointer) const {
+  assert(m_buffer <= pointer);
+  if (!lineIndexIsValid()) {
+    int y = 0;
+    for (Line l : *this) {
+      if (l.contains(pointer)) {
+        return y;
+      }
+      y++;
+    }
+    assert(false);
+    return 0;
+  }
+  // Find the last line starting at or before pointer
+  size_t offset = pointer - m_buffer;
+  int lower = 0;
+  int upper = m_numberOfIndexedLines;
+  while (upper - lower > 1) {
+    int middle = (lower + upper) / 2;
+    if (m_lineStarts[middle] <= offset) {
+      lower = middle;
+    } else {
+      upper = middle;
+    }
+  }
+  return lower;
+}
+
+void TextArea::Text::rebuildLineIndex() {
+  static_assert(k_maxLines < k_lineIndexSize, "The line index cannot hold the editable lines");
+  m_numberOfIndexedLines = 0;
+  m_lineWidthsFont = nullptr;
+  if (m_buffer == nullptr || m_bufferSize > UINT16_MAX) {
+    return;
+  }
+  int numberOfLines = 0;
+  m_lineStarts[numberOfLines++] = 0;
+  for (const char * c = m_buffer; *c != 0; c++) {
+    if (*c == '\n') {
+      if (numberOfLines >= k_lineIndexSize) {
+        // The text is scanned from its beginning instead
+        return;
+      }
+      m_lineStarts[numberOfLines++] = c + 1 - m_buffer;
+    }
+  }
+  m_numberOfIndexedLines = numberOfLines;
+}
+
+void TextArea::Text::updateLineIndex(const char * start, const char * previousEnd, const char * newEnd) {
+  assert(start <= previousEnd && start <= newEnd);
+  if (!lineIndexIsValid()) {
+    rebuildLineIndex();
+    return;
+  }
+  /* Lines starting in the replaced text are removed, lines starting in the
+   * inserted text are added, and the following ones are shifted. A line starts
+   * after a '\n': the line of start is kept. */
+  assert(UTF8Decoder::CharSizeOfCodePoint('\n') == 1);
+  int firstRemovedLine = lineIndexAtPointer(start) + 1;
+  int firstKeptLine = firstRemovedLine;
+  while (firstKeptLine < m_numberOfIndexedLines && m_buffer + m_lineStarts[firstKeptLine] <= previousEnd) {
+    firstKeptLine++;
+  }
+  int numberOfAddedLines = 0;
+  for (const char * c = start; c < newEnd; c++) {
+    numberOfAddedLines += (*c == '\n');
+  }
+  int numberOfLines = m_numberOfIndexedLines - (firstKeptLine - firstRemovedLine) + numberOfAddedLines;
+  if (numberOfLines > k_lineIndexSize) {
+    rebuildLineIndex();
+    return;
+  }
+  int delta = newEnd - previousEnd;
+  int firstShiftedLine = firstRemovedLine + numberOfAddedLines;
+  int numberOfShiftedLines = m_numberOfIndexedLines - firstKeptLine;
+  memmove(m_lineStarts + firstShiftedLine, m_lineStarts + firstKeptLine, numberOfShiftedLines * sizeof(m_lineStarts[0]));
+  memmove(m_lineWidths + firstShiftedLine, m_lineWidths + firstKeptLine, numberOfShiftedLines * sizeof(m_lineWidths[0]));
+  for (int i = firstShiftedLine; i < numberOfLines; i++) {
+    m_lineStarts[i] += delta;
+  }
+  int line = firstRemovedLine;
+  for (const char * c = start; c < newEnd; c++) {
+    if (*c == '\n') {
+      m_lineStarts[line++] = c + 1 - m_buffer;
+    }
+  }
+  // The line of start and the added lines have changed
+  for (int i = firstRemovedLine - 1; i < firstShiftedLine; i++) {
+    m_lineWidths[i] = k_unknownLineWidth;
+  }
+  m_numberOfIndexedLines = numberOfLines;
 }
 
 void TextArea::Text::insertText(const char * s, int textLength, char * location) {
@@ -326,6 +456,7 @@ void TextArea::Text::insertText(const char * s, int textLength, char * location)
   assert(location + textLength + sizeToMove <= m_buffer + m_bufferSize);
   memmove(location + textLength, location, sizeToMove);
   memmove(location, s + (noShift ? 0 : textLength), textLength);
+  updateLineIndex(location, location, location + textLength);
 }
 
 void TextArea::Text::insertSpacesAtLocation(int numberOfSpaces, char * location) {
@@ -341,6 +472,7 @@ void TextArea::Text::insertSpacesAtLocation(int numberOfSpaces, char * location)
   for (int i = 0; i < numberOfSpaces; i++) {
     UTF8Decoder::CodePointToChars(' ', location+i*spaceCharSize, (m_buffer + m_bufferSize) - location);
   }
+  updateLineIndex(location, location, location + spacesSize);
 }
 
 CodePoint TextArea::Text::removePreviousGlyph(char * * position) {
@@ -357,6 +489,7 @@ CodePoint TextArea::Text::removePreviousGlyph(char * * position) {
   } else {
     removedSize = UTF8Helper::RemovePreviousGlyph(m_buffer, *position, &removedCodePoint);
     assert(removedSize > 0);
+    updateLineIndex(*position - removedSize, *position, *position - removedSize);
   }
   // Set the new cursor position
   *position = *position - removedSize;
@@ -397,6 +530,7 @@ size_t TextArea::Text::removeText(const char * start, const char * end) {
     *dst = *src;
     if (*src == 0) {
       assert(delta > 0);
+      updateLineIndex(start, end, start);
       return delta;
     }
     dst++;
@@ -473,12 +607,16 @@ KDSize TextArea::Text::span(const KDFont * const font) const {
   assert(m_buffer != nullptr);
   KDCoordinate width = 0;
   int numberOfLines = 0;
-  for (Line l : *this) {
-    KDCoordinate lineWidth = l.glyphWidth(font);
-    if (lineWidth > width) {
-      width = lineWidth;
+  if (lineIndexIsValid()) {
+    numberOfLines = m_numberOfIndexedLines;
+    for (int i = 0; i < numberOfLines; i++) {
+      width = std::max(width, lineWidthAtIndex(i, font));
+    }
+  } else {
+    for (Line l : *this) {
+      width = std::max(width, l.glyphWidth(font));
+      numberOfLines++;
     }
-    numberOfLines++;
   }
   return KDSize(width, numberOfLines * font->glyphSize().height());
 }
@@ -502,14 +640,12 @@ void TextArea::ContentView::drawRect(KDContext * ctx, KDRect rect) const {
     rect.bottom()/glyphSize.height() + 1
   );
 
-  int y = 0;
-
-  for (Text::Line line : m_text) {
-    KDCoordinate width = line.glyphWidth(m_font);
-    if (y >= topLeft.line() && y <= bottomRight.line() && topLeft.column() < (int)width) {
+  int lastLine = std::min(bottomRight.line(), m_text.numberOfLines() - 1);
+  for (int y = std::max(topLeft.line(), 0); y <= lastLine; y++) {
+    Text::Line line = m_text.lineAtIndex(y);
+    if (topLeft.column() < (int)m_text.lineWidthAtIndex(y, m_font)) {
       drawLine(ctx, y, line.text(), line.charLength(), topLeft.column(), bottomRight.column(), m_selectionStart, m_selectionEnd);
     }
-    y++;
   }
 }
 
@@ -642,19 +778,7 @@ KDRect TextArea::ContentView::glyphFrameAtPosition(const char * text, const char
   KDSize glyphSize = m_font->glyphSize();
   Text::Position p = m_text.positionAtPointer(position);
 
-  KDCoordinate x = 0;
-  bool found = false;
-  int y = 0;
-  for (Text::Line l : m_text) {
-    if (p.line() == y) {
-      x = m_font->stringSizeUntil(l.text(), position).width();
-      found = true;
-      break;
-    }
-    y++;
-  }
-  assert(found);
-  (void) found;
+  KDCoordinate x = m_font->stringSizeUntil(m_text.lineAtIndex(p.line()).text(), position).width();
 
   // Check for KDCoordinate overflow
   assert(x < KDCOORDINATE_MAX - glyphSize.width() && p.line() * glyphSize.height() < KDCOORDINATE_MAX - glyphSize.height());
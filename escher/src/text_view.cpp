@@ -1,4 +1,5 @@
 #include <escher/text_view.h>
+#include <string.h>
 
 void TextView::setBackgroundColor(KDColor backgroundColor) {
   if (m_backgroundColor != backgroundColor) {
@@ -40,6 +41,17 @@ void TextView::drawRect(KDContext * ctx, KDRect rect) const {
   KDPoint origin(
       m_horizontalAlignment * (m_frame.width() - textSize.width()),
       m_verticalAlignment * (m_frame.height() - textSize.height()));
-  ctx->fillRect(bounds(), m_backgroundColor);
+  /* The glyphs of a single line are pushed with their background, so only the
+   * margins around them need to be filled. Tabulations and line breaks leave
+   * gaps between glyphs. */
+  if (strpbrk(text(), "\t\n") == nullptr) {
+    KDRect margins[KDRect::k_maxNumberOfPiecesOfSubtraction] = {KDRectZero, KDRectZero, KDRectZero, KDRectZero};
+    int numberOfMargins = bounds().subtractedBy(KDRect(origin, textSize), margins);
+    for (int i = 0; i < numberOfMargins; i++) {
+      ctx->fillRect(margins[i], m_backgroundColor);
+    }
+  } else {
+    ctx->fillRect(bounds(), m_backgroundColor);
+  }
   ctx->drawString(text(), origin, m_font, m_textColor, m_backgroundColor);
 }
@@ -2,6 +2,7 @@ extern "C" {
 #include <assert.h>
 }
 #include <escher/view.h>
+#include <ion/profiler.h>
 
 const Window * View::window() const {
   if (m_superview == nullptr) {
@@ -40,15 +41,24 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
     .unionedWith(forceRedrawRect
       .intersectedWith(bounds()));
 
-  // This redraws the rectNeedingRedraw calling drawRect.
+  /* This redraws the rectNeedingRedraw calling drawRect, except for the parts
+   * covered by opaque subviews: they are redrawn anyway since they are in the
+   * area forced to be redrawn in the subviews. */
   if (!rectNeedingRedraw.isEmpty()) {
+    KDRect rectsToDraw[k_maxNumberOfRectsToDraw] = {KDRectZero, KDRectZero, KDRectZero, KDRectZero};
+    int numberOfRectsToDraw = rectsNotCoveredBySubviews(rectNeedingRedraw, rectsToDraw);
     KDPoint absOrigin = absoluteOrigin();
-    KDRect absRect = rectNeedingRedraw.translatedBy(absOrigin);
-    KDRect absClippingRect = absoluteVisibleFrame().intersectedWith(absRect);
+    KDRect absVisibleFrame = absoluteVisibleFrame();
     KDContext * ctx = KDIonContext::sharedContext();
-    ctx->setOrigin(absOrigin);
-    ctx->setClippingRect(absClippingRect);
-    this->drawRect(ctx, rectNeedingRedraw);
+    for (int i = 0; i < numberOfRectsToDraw; i++) {
+      KDRect absRect = rectsToDraw[i].translatedBy(absOrigin);
+      KDRect absClippingRect = absVisibleFrame.intersectedWith(absRect);
+      ctx->setOrigin(absOrigin);
+      ctx->setClippingRect(absClippingRect);
+      Ion::Profiler::beginDrawRect(this);
+      this->drawRect(ctx, rectsToDraw[i]);
+      Ion::Profiler::endDrawRect(this);
+    }
   }
   // This initializes the area that has been redrawn.
   KDRect redrawnArea = rectNeedingRedraw;
@@ -83,6 +93,45 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
   return redrawnArea;
 }
 
+int View::rectsNotCoveredBySubviews(KDRect rect, KDRect rects[k_maxNumberOfRectsToDraw]) {
+  rects[0] = rect;
+  int numberOfRects = 1;
+  for (uint8_t i=0; i<numberOfSubviews() && numberOfRects > 0; i++) {
+    View * subview = this->subview(i);
+    if (subview == nullptr) {
+      continue;
+    }
+    KDRect opaqueRect = subview->opaqueRect()
+      .translatedBy(subview->m_frame.origin())
+      .intersectedWith(subview->m_frame);
+    if (opaqueRect.isEmpty()) {
+      continue;
+    }
+    KDRect remainingRects[k_maxNumberOfRectsToDraw] = {KDRectZero, KDRectZero, KDRectZero, KDRectZero};
+    int numberOfRemainingRects = 0;
+    bool tooManyRects = false;
+    for (int j = 0; j < numberOfRects; j++) {
+      KDRect pieces[KDRect::k_maxNumberOfPiecesOfSubtraction] = {KDRectZero, KDRectZero, KDRectZero, KDRectZero};
+      int numberOfPieces = rects[j].subtractedBy(opaqueRect, pieces);
+      if (numberOfRemainingRects + numberOfPieces > k_maxNumberOfRectsToDraw) {
+        tooManyRects = true;
+        break;
+      }
+      for (int k = 0; k < numberOfPieces; k++) {
+        remainingRects[numberOfRemainingRects++] = pieces[k];
+      }
+    }
+    if (tooManyRects) {
+      continue;
+    }
+    for (int j = 0; j < numberOfRemainingRects; j++) {
+      rects[j] = remainingRects[j];
+    }
+    numberOfRects = numberOfRemainingRects;
+  }
+  return numberOfRects;
+}
+
 View * View::subview(int index) {
   assert(index >= 0 && index < numberOfSubviews());
   View * subview = subviewAtIndex(index);
@@ -121,6 +170,7 @@ void View::setFrame(KDRect frame, bool force) {
   // FIXME: m_dirtyRect = bounds(); would be more correct (in case the view is being shrinked)
 
   if (!m_frame.isEmpty()) {
+    Ion::Profiler::PhaseScope profilerScope(Ion::Profiler::Phase::Layout);
     layoutSubviews(force);
   }
 }
@@ -1,10 +1,12 @@
 #include <escher/window.h>
 #include <ion.h>
+#include <ion/profiler.h>
 extern "C" {
 #include <assert.h>
 }
 
 void Window::redraw(bool force) {
+  Ion::Profiler::PhaseScope profilerScope(Ion::Profiler::Phase::Redraw);
   if (force) {
     markRectAsDirty(bounds());
   }
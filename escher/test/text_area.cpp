@@ -0,0 +1,95 @@
+#include <quiz.h>
+#include <string.h>
+#include <algorithm>
+#include <escher/text_area.h>
+
+class TextAreaTest : public TextArea {
+public:
+  using TextArea::Text;
+};
+
+typedef TextAreaTest::Text Text;
+
+/* Check the line index of text against a scan of its buffer: each code point
+ * is at the position of its line start and its column. */
+void assert_line_index_is_up_to_date(Text * text) {
+  const char * buffer = text->text();
+  int line = 0;
+  int column = 0;
+  const char * lineStart = buffer;
+  const KDFont * font = KDFont::LargeFont;
+  KDCoordinate width = 0;
+  for (const char * c = buffer; ; c++) {
+    Text::Position p = text->positionAtPointer(c);
+    quiz_assert(p.line() == line && p.column() == column);
+    quiz_assert(text->pointerAtPosition(p) == c);
+    if (*c == 0 || *c == '\n') {
+      quiz_assert(text->lineAtIndex(line).text() == lineStart);
+      width = std::max(width, font->stringSizeUntil(lineStart, c).width());
+      quiz_assert(text->lineWidthAtIndex(line, font) == font->stringSizeUntil(lineStart, c).width());
+    }
+    if (*c == 0) {
+      break;
+    }
+    if (*c == '\n') {
+      line++;
+      column = 0;
+      lineStart = c + 1;
+    } else {
+      column++;
+    }
+  }
+  quiz_assert(text->textLineTotal() == line);
+  KDSize span = text->span(font);
+  quiz_assert(span.width() == width && span.height() == (line + 1) * font->glyphSize().height());
+}
+
+QUIZ_CASE(escher_text_area_line_index) {
+  constexpr int bufferSize = 100;
+  char buffer[bufferSize] = "def f(x):\n  return x\n\nprint(f(2))";
+  Text text(buffer, bufferSize);
+  assert_line_index_is_up_to_date(&text);
+
+  // Insert lines
+  text.insertText("a = 1\nb = 2\n", 12, buffer + 10);
+  assert_line_index_is_up_to_date(&text);
+  // Insert in a line
+  text.insertText("12", 2, buffer + 4);
+  assert_line_index_is_up_to_date(&text);
+  text.insertSpacesAtLocation(3, buffer);
+  assert_line_index_is_up_to_date(&text);
+  // Remove lines
+  text.removeText(buffer + 8, buffer + 30);
+  assert_line_index_is_up_to_date(&text);
+  // Remove a line break
+  char * position = strchr(buffer, '\n') + 1;
+  text.removePreviousGlyph(&position);
+  assert_line_index_is_up_to_date(&text);
+  // Remove a glyph
+  text.removePreviousGlyph(&position);
+  assert_line_index_is_up_to_date(&text);
+  text.removeRemainingLine(position, 1);
+  assert_line_index_is_up_to_date(&text);
+  // Everything
+  text.removeText(buffer, buffer + strlen(buffer));
+  assert_line_index_is_up_to_date(&text);
+  text.insertText("\n\n", 2, buffer);
+  assert_line_index_is_up_to_date(&text);
+}
+
+QUIZ_CASE(escher_text_area_too_many_lines_to_index) {
+  constexpr int bufferSize = 2500;
+  char buffer[bufferSize];
+  for (int i = 0; i < 1100; i++) {
+    buffer[2*i] = 'a';
+    buffer[2*i + 1] = '\n';
+  }
+  buffer[2200] = 0;
+  Text text(buffer, bufferSize);
+  assert_line_index_is_up_to_date(&text);
+  // The line index is built again once the text is short enough
+  text.removeText(buffer + 10, buffer + 2000);
+  assert_line_index_is_up_to_date(&text);
+  text.insertText("b\nc\n", 4, buffer + 3);
+  assert_line_index_is_up_to_date(&text);
+}
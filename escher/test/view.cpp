@@ -0,0 +1,68 @@
+#include <quiz.h>
+#include <ion/display.h>
+#include <escher/solid_color_view.h>
+#include <escher/window.h>
+
+/* The rects a parent and its opaque children are asked to draw are recorded to
+ * check that the parts covered by the children are left out of the parent's
+ * rects, and are still drawn by the children. */
+
+class RecordingSolidColorView : public SolidColorView {
+public:
+  RecordingSolidColorView() : SolidColorView(KDColorBlue), m_drawnArea(0) {}
+  void drawRect(KDContext * ctx, KDRect rect) const override {
+    SolidColorView::drawRect(ctx, rect);
+    m_drawnArea += rect.width() * rect.height();
+  }
+  mutable int m_drawnArea;
+};
+
+class ParentView : public View {
+public:
+  ParentView(KDRect firstChildFrame, KDRect secondChildFrame) :
+    m_firstChildFrame(firstChildFrame),
+    m_secondChildFrame(secondChildFrame),
+    m_numberOfDrawRects(0),
+    m_drawnArea(0)
+  {}
+  void drawRect(KDContext * ctx, KDRect rect) const override {
+    ctx->fillRect(bounds(), KDColorRed);
+    m_numberOfDrawRects++;
+    m_drawnArea += rect.width() * rect.height();
+  }
+  RecordingSolidColorView m_children[2];
+  KDRect m_firstChildFrame;
+  KDRect m_secondChildFrame;
+  mutable int m_numberOfDrawRects;
+  mutable int m_drawnArea;
+private:
+  int numberOfSubviews() const override { return 2; }
+  View * subviewAtIndex(int index) override { return &m_children[index]; }
+  void layoutSubviews(bool force = false) override {
+    m_children[0].setFrame(m_firstChildFrame, force);
+    m_children[1].setFrame(m_secondChildFrame, force);
+  }
+};
+
+static void assert_redraw_skips_children(KDRect firstChildFrame, KDRect secondChildFrame, int numberOfDrawRects) {
+  constexpr int screenArea = Ion::Display::Width * Ion::Display::Height;
+  Window window;
+  window.setFrame(KDRect(0, 0, Ion::Display::Width, Ion::Display::Height), false);
+  ParentView parent(firstChildFrame, secondChildFrame);
+  window.setContentView(&parent);
+  window.redraw(true);
+
+  int firstChildArea = firstChildFrame.width() * firstChildFrame.height();
+  int secondChildArea = secondChildFrame.width() * secondChildFrame.height();
+  quiz_assert(parent.m_numberOfDrawRects == numberOfDrawRects);
+  quiz_assert(parent.m_drawnArea == screenArea - firstChildArea - secondChildArea);
+  quiz_assert(parent.m_children[0].m_drawnArea == firstChildArea);
+  quiz_assert(parent.m_children[1].m_drawnArea == secondChildArea);
+}
+
+QUIZ_CASE(escher_view_opaque_subviews) {
+  // A band at the top and a rect in the middle
+  assert_redraw_skips_children(KDRect(0, 0, Ion::Display::Width, 20), KDRect(100, 100, 50, 30), 4);
+  // Two bands splitting the parent
+  assert_redraw_skips_children(KDRect(0, 0, Ion::Display::Width, 20), KDRect(0, 100, Ion::Display::Width, 30), 2);
+}
@@ -56,6 +56,15 @@ void setStackStart(void *);
 // Tells whether the stack pointer is within acceptable bounds
 bool stackSafe();
 
+/* Stack usage accounting. paintStack fills the unused stack with a pattern
+ * down to k_stackSize below stackStart. stackUsage then tells how deep below
+ * stackStart the pattern has been overwritten since: the stack high-water mark.
+ * The depth is saturated at k_stackSize, the STACK_SIZE of the device linker
+ * scripts, which the device checks when painting its stack. */
+constexpr size_t k_stackSize = 32768;
+void paintStack();
+size_t stackUsage();
+
 // Collect registers in a buffer and returns the stack pointer
 uintptr_t collectRegisters(jmp_buf regs);
 
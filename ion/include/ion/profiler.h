@@ -0,0 +1,71 @@
+#ifndef ION_PROFILER_H
+#define ION_PROFILER_H
+
+#include <ion/events.h>
+#include <kandinsky/rect.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* The profiler records where the time goes when handling each event: event
+ * handling, layout and redraw phases, drawRect calls per view class, pixels
+ * pushed to the display and how many of them overwrite a pixel pushed for the
+ * same event, and peaks of the Poincare pool and of the stack, the latter
+ * measured by painting the stack at each event. It is only available
+ * on the simulator when building with EPSILON_PROFILE=1; otherwise all these
+ * calls compile to nothing. The report is written as JSON when the program
+ * exits, to the path given by the EPSILON_PROFILE_OUTPUT environment variable
+ * or to epsilon_profile.json. */
+
+namespace Ion {
+namespace Profiler {
+
+enum class Phase : uint8_t {
+  EventHandling,
+  Layout,
+  Redraw
+};
+constexpr int k_numberOfPhases = 3;
+
+#if EPSILON_PROFILE
+
+void beginEvent(Events::Event event);
+void endEvent();
+void beginPhase(Phase phase);
+void endPhase(Phase phase);
+// The view's class is identified by its virtual table
+void beginDrawRect(const void * view);
+void endDrawRect(const void * view);
+void countPushedPixels(KDRect rect, bool uniform);
+void reportTreePoolUsage(size_t size);
+
+#else
+
+inline void beginEvent(Events::Event event) {}
+inline void endEvent() {}
+inline void beginPhase(Phase phase) {}
+inline void endPhase(Phase phase) {}
+inline void beginDrawRect(const void * view) {}
+inline void endDrawRect(const void * view) {}
+inline void countPushedPixels(KDRect rect, bool uniform) {}
+inline void reportTreePoolUsage(size_t size) {}
+
+#endif
+
+class EventScope {
+public:
+  EventScope(Events::Event event) { beginEvent(event); }
+  ~EventScope() { endEvent(); }
+};
+
+class PhaseScope {
+public:
+  PhaseScope(Phase phase) : m_phase(phase) { beginPhase(phase); }
+  ~PhaseScope() { endPhase(m_phase); }
+private:
+  Phase m_phase;
+};
+
+}
+}
+
+#endif
@@ -27,6 +27,9 @@ public:
   static constexpr char expExtension[] = "exp";
   static constexpr char funcExtension[] = "func";
   static constexpr char seqExtension[] = "seq";
+  /* Records with this extension hold data the apps can compute again. They
+   * are not files of the user, and are hidden from Python. */
+  static constexpr char cacheExtension[] = "cache";
 
   class Record {
     /* A Record is identified by the CRC32 on its fullName because:
@@ -94,6 +97,7 @@ public:
   size_t putAvailableSpaceAtEndOfRecord(Record r);
   void getAvailableSpaceFromEndOfRecord(Record r, size_t recordAvailableSpace);
   uint32_t checksum();
+  uint32_t checksumOfRecordsWithExtensions(const char * const extensions[], size_t numberOfExtensions);
 
   // Delegate
   void setDelegate(StorageDelegate * delegate) { m_delegate = delegate; }
@@ -102,6 +106,7 @@ public:
 
   int numberOfRecordsWithExtension(const char * extension);
   static bool FullNameHasExtension(const char * fullName, const char * extension, size_t extensionLength);
+  static bool FullNameIsCache(const char * fullName) { return FullNameHasExtension(fullName, cacheExtension, sizeof(cacheExtension) - 1); }
 
   // Record creation
   Record::ErrorStatus createRecordWithFullName(const char * fullName, const void * data, size_t size);
@@ -1,6 +1,7 @@
 #include <ion/events.h>
 #include <ion/usb.h>
 #include <ion/battery.h>
+#include <ion/timing.h>
 #include <assert.h>
 
 namespace Ion {
@@ -40,5 +41,12 @@ Event getPlatformEvent() {
   return None;
 }
 
+void waitForPlatformEvent(int maximumDelay) {
+  /* The keyboard and the USB and battery states are polled: no interrupt
+   * wakes us up when they change. */
+  constexpr int pollingPeriod = 10;
+  Timing::msleep(maximumDelay < pollingPeriod ? maximumDelay : pollingPeriod);
+}
+
 }
 }
@@ -7,6 +7,7 @@ namespace Ion {
 namespace Events {
 
 Event getPlatformEvent();
+void waitForPlatformEvent(int maximumDelay);
 
 }
 }
@@ -5,18 +5,6 @@
 namespace Ion {
 namespace Events {
 
-static bool sleepWithTimeout(int duration, int * timeout) {
-  if (*timeout >= duration) {
-    Timing::msleep(duration);
-    *timeout -= duration;
-    return false;
-  } else {
-    Timing::msleep(*timeout);
-    *timeout = 0;
-    return true;
-  }
-}
-
 Event sLastEvent = Events::None;
 Keyboard::State sLastKeyboardState;
 bool sLastEventShift;
@@ -39,12 +27,22 @@ static bool canRepeatEvent(Event e) {
 }
 
 Event getPlatformEvent();
+/* Wait until the platform may have a new event or keyboard state, or until
+ * maximumDelay milliseconds have elapsed. Only the headless simulator truly
+ * sleeps until its next input; the other platforms poll every 10 ms, either
+ * themselves or through SDL_WaitEventTimeout. */
+void waitForPlatformEvent(int maximumDelay);
 
 void ComputeAndSetRepetionFactor(int eventRepetitionCount) {
   // The Repetition factor is increased by 4 every 20 loops in getEvent(2 sec)
   setLongRepetition((eventRepetitionCount / 20) * 4 + 1);
 }
 
+static void setRemainingTimeout(int * timeout, uint64_t timeoutTime) {
+  uint64_t currentTime = Timing::millis();
+  *timeout = currentTime < timeoutTime ? timeoutTime - currentTime : 0;
+}
+
 void resetLongRepetition() {
   sEventRepetitionCount = 0;
   ComputeAndSetRepetionFactor(sEventRepetitionCount);
@@ -53,12 +51,16 @@ void resetLongRepetition() {
 Event getEvent(int * timeout) {
   assert(*timeout > delayBeforeRepeat);
   assert(*timeout > delayBetweenRepeat);
-  int time = 0;
+  /* Delays are measured from timestamps rather than accumulated from the
+   * waits, which can be interrupted by inputs. */
+  uint64_t startTime = Timing::millis();
+  uint64_t timeoutTime = startTime + *timeout;
   uint64_t keysSeenUp = 0;
   uint64_t keysSeenTransitionningFromUpToDown = 0;
   while (true) {
     Event platformEvent = getPlatformEvent();
     if (platformEvent != None) {
+      setRemainingTimeout(timeout, timeoutTime);
       return platformEvent;
     }
 
@@ -100,31 +102,38 @@ Event getEvent(int * timeout) {
       updateModifiersFromEvent(event);
       sLastEvent = event;
       sLastKeyboardState = state;
+      setRemainingTimeout(timeout, timeoutTime);
       return event;
     }
 
-    if (sleepWithTimeout(10, timeout)) {
-      // Timeout occurred
-      resetLongRepetition();
-      return Events::None;
-    }
-    time += 10;
-
     // At this point, we know that keysSeenTransitionningFromUpToDown has *always* been zero
     // In other words, no new key has been pressed
+    uint64_t currentTime = Timing::millis();
+    uint64_t wakeUpTime = timeoutTime;
     if (canRepeatEvent(sLastEvent)
         && state == sLastKeyboardState
         && sLastEventShift == state.keyDown(Keyboard::Key::Shift)
         && sLastEventAlpha == (state.keyDown(Keyboard::Key::Alpha) || lock))
     {
-      int delay = (sEventIsRepeating ? delayBetweenRepeat : delayBeforeRepeat);
-      if (time >= delay) {
+      uint64_t repeatTime = startTime + (sEventIsRepeating ? delayBetweenRepeat : delayBeforeRepeat);
+      if (currentTime >= repeatTime) {
         sEventIsRepeating = true;
         sEventRepetitionCount++;
         ComputeAndSetRepetionFactor(sEventRepetitionCount);
+        setRemainingTimeout(timeout, timeoutTime);
         return sLastEvent;
       }
+      // The repeat delays are shorter than the timeout
+      wakeUpTime = repeatTime;
+    }
+
+    if (currentTime >= timeoutTime) {
+      // Timeout occurred
+      *timeout = 0;
+      resetLongRepetition();
+      return Events::None;
     }
+    waitForPlatformEvent(wakeUpTime - currentTime);
   }
 }
 
@@ -1,5 +1,10 @@
 #include <ion.h>
 
+#if PLATFORM_DEVICE
+extern const void * _stack_start;
+extern const void * _stack_end;
+#endif
+
 namespace Ion {
 
 #if PLATFORM_DEVICE
@@ -19,4 +24,37 @@ void setStackStart(void * pointer) {
   assert(pointer != nullptr);
   s_stackStart = pointer;
 }
+
+static constexpr uint32_t k_stackPaint = 0xDEADBEEF;
+/* The frame of paintStack and what a leaf function it calls may keep below
+ * the stack pointer (the red zone on x86-64) are not painted. */
+static constexpr size_t k_stackPaintMargin = 256;
+
+static volatile uint32_t * stackBottom() {
+#if PLATFORM_DEVICE
+  /* The linker scripts do not see k_stackSize: they reserve STACK_SIZE bytes,
+   * the last 8 of which are above _stack_start. */
+  assert(reinterpret_cast<const char *>(&_stack_start) + 8 - reinterpret_cast<const char *>(&_stack_end) == k_stackSize);
+#endif
+  uintptr_t bottom = reinterpret_cast<uintptr_t>(stackStart()) - k_stackSize;
+  bottom = (bottom + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1);
+  return reinterpret_cast<volatile uint32_t *>(bottom);
+}
+
+void paintStack() {
+  volatile int stackDummy;
+  volatile uint32_t * top = reinterpret_cast<volatile uint32_t *>(reinterpret_cast<uintptr_t>(&stackDummy) - k_stackPaintMargin);
+  for (volatile uint32_t * p = stackBottom(); p < top; p++) {
+    *p = k_stackPaint;
+  }
+}
+
+size_t stackUsage() {
+  volatile uint32_t * p = stackBottom();
+  volatile uint32_t * start = static_cast<volatile uint32_t *>(stackStart());
+  while (p < start && *p == k_stackPaint) {
+    p++;
+  }
+  return reinterpret_cast<uintptr_t>(stackStart()) - reinterpret_cast<uintptr_t>(p);
+}
 }
\ No newline at end of file
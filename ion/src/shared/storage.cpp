@@ -26,6 +26,7 @@ constexpr char Storage::expExtension[];
 constexpr char Storage::funcExtension[];
 constexpr char Storage::seqExtension[];
 constexpr char Storage::eqExtension[];
+constexpr char Storage::cacheExtension[];
 
 Storage * Storage::sharedStorage() {
   static Storage * storage = new (staticStorageArea) Storage();
@@ -130,6 +131,23 @@ uint32_t Storage::checksum() {
   return Ion::crc32Byte((const uint8_t *) m_buffer, endBuffer()-m_buffer);
 }
 
+uint32_t Storage::checksumOfRecordsWithExtensions(const char * const extensions[], size_t numberOfExtensions) {
+  /* The records are read in a single pass, instead of being looked up one by
+   * one as Record::checksum would. */
+  uint32_t crc32Results[2] = {0, 0};
+  for (char * p : *this) {
+    const char * fullName = fullNameOfRecordStarting(p);
+    for (size_t i = 0; i < numberOfExtensions; i++) {
+      if (FullNameHasExtension(fullName, extensions[i], strlen(extensions[i]))) {
+        crc32Results[1] = Ion::crc32Byte((const uint8_t *)p, sizeOfRecordStarting(p));
+        crc32Results[0] = Ion::crc32Word(crc32Results, 2);
+        break;
+      }
+    }
+  }
+  return crc32Results[0];
+}
+
 void Storage::notifyChangeToDelegate(const Record record) const {
   m_lastRecordRetrieved = Record(nullptr);
   m_lastRecordRetrievedPointer = nullptr;
@@ -4,6 +4,7 @@
 
 #include <assert.h>
 #include <ion/events.h>
+#include <ion/timing.h>
 #include <string.h>
 
 #include <3ds.h>
@@ -34,5 +35,11 @@ Event getPlatformEvent() {
   return result;
 }
 
+void waitForPlatformEvent(int maximumDelay) {
+  // The buttons and the USB state are polled
+  constexpr int pollingPeriod = 10;
+  Timing::msleep(maximumDelay < pollingPeriod ? maximumDelay : pollingPeriod);
+}
+
 }
 }
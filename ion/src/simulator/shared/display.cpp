@@ -3,7 +3,6 @@
 #include <assert.h>
 #include <ion/display.h>
 #include <SDL.h>
-#include <string.h>
 
 namespace Ion {
 namespace Simulator {
@@ -29,12 +28,14 @@ void quit() {
 }
 
 void draw(SDL_Renderer * renderer, SDL_Rect * rect) {
-  int pitch = 0;
-  void * pixels = nullptr;
-  SDL_LockTexture(sFramebufferTexture, nullptr, &pixels, &pitch);
-  assert(pitch == sizeof(KDColor)*Ion::Display::Width);
-  memcpy(pixels, Framebuffer::address(), sizeof(KDColor)*Ion::Display::Width*Ion::Display::Height);
-  SDL_UnlockTexture(sFramebufferTexture);
+  // Only upload the areas of the framebuffer written since the last draw
+  const int pitch = sizeof(KDColor)*Ion::Display::Width;
+  for (int i = 0; i < Framebuffer::numberOfDirtyRects(); i++) {
+    KDRect r = Framebuffer::dirtyRect(i);
+    SDL_Rect dirtyRect = {r.x(), r.y(), r.width(), r.height()};
+    SDL_UpdateTexture(sFramebufferTexture, &dirtyRect, Framebuffer::address() + r.y()*Ion::Display::Width + r.x(), pitch);
+  }
+  Framebuffer::clearDirtyRects();
 
   SDL_RenderCopy(renderer, sFramebufferTexture, nullptr, rect);
 }
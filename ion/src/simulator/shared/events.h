@@ -10,6 +10,13 @@ namespace Events {
 
 void dumpEventCount(int i);
 void logAfter(int numberOfEvents);
+/* Once stdin is exhausted, each branch file is replayed in a child process
+ * forked from the current state, so that scenarios sharing a prefix only
+ * replay it once. */
+void addBranch(const char * path);
+/* Replay fuzzing inputs from memory, each one in a child process forked once
+ * the first event is requested. */
+void enableFuzzing();
 
 }
 }
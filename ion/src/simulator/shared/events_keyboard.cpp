@@ -5,6 +5,7 @@
 
 #include <assert.h>
 #include <ion/events.h>
+#include <ion/timing.h>
 #include <ion/unicode/utf8_helper.h>
 #include <SDL.h>
 #include <string.h>
@@ -182,7 +183,7 @@ Event getPlatformEvent() {
   Event result = None;
   while (SDL_PollEvent(&event)) {
     // The while is important: it'll do a fast-pass over all useless SDL events
-    if (event.type == SDL_WINDOWEVENT) {
+    if (event.type == SDL_WINDOWEVENT || event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET) {
       Ion::Simulator::Main::relayout();
       break;
     }
@@ -230,5 +231,24 @@ Event getPlatformEvent() {
   return result;
 }
 
+void waitForPlatformEvent(int maximumDelay) {
+#if EPSILON_SDL_SCREEN_ONLY || defined(__EMSCRIPTEN__)
+  /* Events can be queued without going through SDL, and the browser needs the
+   * hand back regularly: keep polling. */
+  constexpr int pollingPeriod = 10;
+  Timing::msleep(maximumDelay < pollingPeriod ? maximumDelay : pollingPeriod);
+#else
+  /* SDL_WaitEventTimeout does not block on the display: it pumps events and
+   * sleeps in 10 ms steps until one is queued or maximumDelay has elapsed.
+   * The idle simulator thus still wakes up every 10 ms, an event may wait up
+   * to 10 ms before being noticed, and the timeout can overshoot by as much.
+   * What it saves over a plain sleep is the return to the Ion event loop: the
+   * keyboard scan and the repeat bookkeeping only run once something is
+   * queued or a deadline is reached. The event is left in the queue for
+   * getPlatformEvent and the keyboard scan to handle. */
+  SDL_WaitEventTimeout(nullptr, maximumDelay);
+#endif
+}
+
 }
 }
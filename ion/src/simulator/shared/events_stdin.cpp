@@ -2,26 +2,137 @@
 #include "platform.h"
 #include "framebuffer.h"
 #include "events.h"
+#include "timing.h"
 
 #include <ion/events.h>
+#include <ion/timing.h>
 #include <layout_events.h>
 
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
+#ifndef __WIN32__
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 void IonSimulatorEventsPushEvent(int eventNumber) {
 }
 
 static int sLogAfterNumberOfEvents = -1;
 static int sEventCount = 0;
+static uint64_t sNextEventTime = 0;
+static constexpr int k_maxNumberOfBranches = 64;
+static const char * sBranches[k_maxNumberOfBranches];
+static int sNumberOfBranches = 0;
+static int sBranchIndex = -1;
+static bool sFuzzing = false;
+static constexpr int k_maxFuzzingInputLength = 1 << 16;
+static constexpr int k_fuzzingIterationsPerProcess = 10000;
+static char sFuzzingInput[k_maxFuzzingInputLength];
+static int sFuzzingInputLength = -1;
+static int sFuzzingInputPosition = 0;
+
+static int nextInputChar() {
+  if (sFuzzingInputLength >= 0) {
+    return sFuzzingInputPosition < sFuzzingInputLength ? static_cast<unsigned char>(sFuzzingInput[sFuzzingInputPosition++]) : EOF;
+  }
+  return getchar();
+}
+
+#ifndef __WIN32__
+static void replayBranches() {
+  /* Returns in the children only, with stdin reading their branch. The parent
+   * waits for each of them in turn, so that their outputs do not mix, and
+   * exits with their status. */
+  int numberOfFailures = 0;
+  for (int i = 0; i < sNumberOfBranches; i++) {
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+      sBranchIndex = i;
+      if (freopen(sBranches[i], "rb", stdin) == nullptr) {
+        printf("Cannot open branch %s\n", sBranches[i]);
+        exit(1);
+      }
+      return;
+    }
+    int status = 0;
+    if (pid < 0 || waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      printf("Branch %s failed\n", sBranches[i]);
+      numberOfFailures++;
+    }
+  }
+  fflush(stdout);
+  exit(numberOfFailures == 0 ? 0 : 1);
+}
+#endif
+
+#ifndef __WIN32__
+static void fuzzInputs() {
+  /* The state reached when the first event is requested is the checkpoint:
+   * each input is read into memory and replayed in a child forked from it.
+   * Storage, preferences and apps are thus reset for free between inputs,
+   * and initialization and boot are only paid once. Returns in the children
+   * only. With afl-clang-fast, this process is kept alive by the fuzzer
+   * between inputs in persistent mode. */
+#ifdef __AFL_HAVE_MANUAL_CONTROL
+  __AFL_INIT();
+  while (__AFL_LOOP(k_fuzzingIterationsPerProcess)) {
+#else
+  for (int i = 0; i < 1; i++) {
+#endif
+    sFuzzingInputLength = 0;
+    ssize_t length;
+    while (sFuzzingInputLength < k_maxFuzzingInputLength && (length = read(0, sFuzzingInput + sFuzzingInputLength, k_maxFuzzingInputLength - sFuzzingInputLength)) > 0) {
+      sFuzzingInputLength += length;
+    }
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+      return;
+    }
+    int status = 0;
+    if (pid < 0 || waitpid(pid, &status, 0) < 0) {
+      exit(1);
+    }
+    if (WIFSIGNALED(status)) {
+      // Report the crash of the child to the fuzzer
+      signal(WTERMSIG(status), SIG_DFL);
+      raise(WTERMSIG(status));
+    }
+  }
+  exit(0);
+}
+#endif
 
 namespace Ion {
 namespace Events {
 
 Event getPlatformEvent() {
+#ifndef __WIN32__
+  if (sFuzzing) {
+    sFuzzing = false;
+    fuzzInputs();
+  }
+#endif
+  /* With the virtual clock, the next event is held back until its arrival
+   * time. Meanwhile, getEvent sleeps, which advances the clock up to the
+   * timeout so that timers fire. */
+  bool virtualClock = Ion::Simulator::Timing::virtualClockIsEnabled();
+  if (virtualClock && Ion::Timing::millis() < sNextEventTime) {
+    return Ion::Events::None;
+  }
   Ion::Events::Event event = Ion::Events::None;
   while (!(event.isDefined() && event.isKeyboardEvent())) {
-    int c = getchar();
+    int c = nextInputChar();
+#ifndef __WIN32__
+    if (c == EOF && sBranchIndex < 0 && sNumberOfBranches > 0) {
+      replayBranches();
+      continue;
+    }
+#endif
     if (c == EOF) {
       printf("Finished processing %d events\n", sEventCount);
       event = Ion::Events::Termination;
@@ -29,10 +140,17 @@ Event getPlatformEvent() {
     }
     event = Ion::Events::Event(c);
   }
+  if (virtualClock) {
+    sNextEventTime = Ion::Timing::millis() + Ion::Simulator::Timing::virtualEventInterval();
+  }
 #if EPSILON_SIMULATOR_HAS_LIBPNG
   if (sEventCount++ > sLogAfterNumberOfEvents && sLogAfterNumberOfEvents >= 0) {
     char filename[32];
-    sprintf(filename, "event%d.png", sEventCount);
+    if (sBranchIndex >= 0) {
+      sprintf(filename, "branch%d_event%d.png", sBranchIndex, sEventCount);
+    } else {
+      sprintf(filename, "event%d.png", sEventCount);
+    }
     Ion::Simulator::Framebuffer::writeToFile(filename);
 #ifndef NDEBUG
     printf("Event %d is %s\n", sEventCount, event.name());
@@ -42,6 +160,18 @@ Event getPlatformEvent() {
   return event;
 }
 
+void waitForPlatformEvent(int maximumDelay) {
+  /* With the virtual clock, sleeping advances the clock: only skip ahead to
+   * the arrival time of the next event. */
+  if (Ion::Simulator::Timing::virtualClockIsEnabled()) {
+    uint64_t currentTime = Ion::Timing::millis();
+    if (sNextEventTime > currentTime && sNextEventTime - currentTime < static_cast<uint64_t>(maximumDelay)) {
+      maximumDelay = sNextEventTime - currentTime;
+    }
+  }
+  Ion::Timing::msleep(maximumDelay);
+}
+
 }
 }
 
@@ -57,6 +187,19 @@ void logAfter(int numberOfEvents) {
   sLogAfterNumberOfEvents = numberOfEvents;
 }
 
+void enableFuzzing() {
+  sFuzzing = true;
+}
+
+void addBranch(const char * path) {
+  // Replaying only part of a scenario would go unnoticed
+  if (sNumberOfBranches >= k_maxNumberOfBranches) {
+    printf("Too many branches, at most %d are supported: cannot add %s\n", k_maxNumberOfBranches, path);
+    exit(1);
+  }
+  sBranches[sNumberOfBranches++] = path;
+}
+
 }
 }
 }
@@ -11,6 +11,15 @@ const KDColor * address();
 void setActive(bool enabled);
 void writeToFile(const char * filename);
 
+/* Areas of the framebuffer written since they were last uploaded to the GPU.
+ * When too many disjoint areas are written, they are merged into their
+ * bounding rectangle. */
+constexpr int k_maxNumberOfDirtyRects = 8;
+int numberOfDirtyRects();
+KDRect dirtyRect(int index);
+void clearDirtyRects();
+void setAllDirty();
+
 }
 }
 }
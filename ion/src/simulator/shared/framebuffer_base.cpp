@@ -1,5 +1,7 @@
 #include "framebuffer.h"
+#include <assert.h>
 #include <ion/display.h>
+#include <ion/profiler.h>
 #include "main.h"
 
 /* Drawing on an SDL texture
@@ -7,14 +9,45 @@
  * the GPU's memory. Reading data back from a texture is not possible, so we
  * simply maintain a framebuffer in RAM since Ion::Display::pullRect expects to
  * be able to read pixel data back.
- * A side effect is that we rewrite the whole texture when redrawing the screen.
- * This might not be the most efficient way since sending pixels to the GPU is
- * rather expensive.
+ * Sending pixels to the GPU is rather expensive, so we keep track of the
+ * areas written since the last upload and only send those.
  * This is also very useful when running headless because we can easily log the
  * framebuffer to a PNG file. */
 
 static KDColor sPixels[Ion::Display::Width * Ion::Display::Height];
 static bool sFrameBufferActive = true;
+/* The texture is uninitialized at first, so the whole screen starts dirty.
+ * KDRect has no default constructor: the list must cover the whole array. */
+static KDRect sDirtyRects[Ion::Simulator::Framebuffer::k_maxNumberOfDirtyRects] = {
+  KDRect(0, 0, Ion::Display::Width, Ion::Display::Height),
+  KDRectZero, KDRectZero, KDRectZero, KDRectZero, KDRectZero, KDRectZero, KDRectZero
+};
+static int sNumberOfDirtyRects = 1;
+
+static void markDirty(KDRect r) {
+  r = r.intersectedWith(KDRect(0, 0, Ion::Display::Width, Ion::Display::Height));
+  if (r.isEmpty()) {
+    return;
+  }
+  for (int i = 0; i < sNumberOfDirtyRects; i++) {
+    if (sDirtyRects[i].containsRect(r)) {
+      return;
+    }
+    if (sDirtyRects[i].intersects(r)) {
+      sDirtyRects[i] = sDirtyRects[i].unionedWith(r);
+      return;
+    }
+  }
+  if (sNumberOfDirtyRects < Ion::Simulator::Framebuffer::k_maxNumberOfDirtyRects) {
+    sDirtyRects[sNumberOfDirtyRects++] = r;
+    return;
+  }
+  for (int i = 1; i < sNumberOfDirtyRects; i++) {
+    r = r.unionedWith(sDirtyRects[i]);
+  }
+  sDirtyRects[0] = r.unionedWith(sDirtyRects[0]);
+  sNumberOfDirtyRects = 1;
+}
 
 namespace Ion {
 namespace Display {
@@ -22,15 +55,19 @@ namespace Display {
 static KDFrameBuffer sFrameBuffer = KDFrameBuffer(sPixels, KDSize(Ion::Display::Width, Ion::Display::Height));
 
 void pushRect(KDRect r, const KDColor * pixels) {
+  Profiler::countPushedPixels(r, false);
   if (sFrameBufferActive) {
     Simulator::Main::setNeedsRefresh();
+    markDirty(r);
     sFrameBuffer.pushRect(r, pixels);
   }
 }
 
 void pushRectUniform(KDRect r, KDColor c) {
+  Profiler::countPushedPixels(r, true);
   if (sFrameBufferActive) {
     Simulator::Main::setNeedsRefresh();
+    markDirty(r);
     sFrameBuffer.pushRectUniform(r, c);
   }
 }
@@ -56,6 +93,24 @@ void setActive(bool enabled) {
   sFrameBufferActive = enabled;
 }
 
+int numberOfDirtyRects() {
+  return sNumberOfDirtyRects;
+}
+
+KDRect dirtyRect(int index) {
+  assert(index >= 0 && index < sNumberOfDirtyRects);
+  return sDirtyRects[index];
+}
+
+void clearDirtyRects() {
+  sNumberOfDirtyRects = 0;
+}
+
+void setAllDirty() {
+  sDirtyRects[0] = KDRect(0, 0, Ion::Display::Width, Ion::Display::Height);
+  sNumberOfDirtyRects = 1;
+}
+
 }
 }
 }
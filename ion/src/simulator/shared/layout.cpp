@@ -239,13 +239,15 @@ void highlightKeyAt(SDL_Point * p) {
   }
   if (newHighlightedKeyIndex != sHighlightedKeyIndex) {
     sHighlightedKeyIndex = newHighlightedKeyIndex;
-    Main::setNeedsRefresh();
+    Main::setNeedsSkinRefresh();
   }
 }
 
 void unhighlightKey() {
-  sHighlightedKeyIndex = -1;
-  Main::setNeedsRefresh();
+  if (sHighlightedKeyIndex >= 0) {
+    sHighlightedKeyIndex = -1;
+    Main::setNeedsSkinRefresh();
+  }
 }
 
 void drawHighlightedKey(SDL_Renderer * renderer) {
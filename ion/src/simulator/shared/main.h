@@ -9,6 +9,7 @@ void init();
 void quit();
 
 void setNeedsRefresh();
+void setNeedsSkinRefresh();
 void refresh();
 void relayout();
 
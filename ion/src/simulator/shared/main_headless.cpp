@@ -3,6 +3,7 @@
 #include "platform.h"
 #include "framebuffer.h"
 #include "events.h"
+#include "timing.h"
 
 #include <ion.h>
 #include <ion/timing.h>
@@ -15,9 +16,7 @@
 
 constexpr int kHeapSize = 131072;
 #ifdef NDEBUG
-/* TODO : Reduce stack memory cost in prime factorization to allow running
- * tests with the actual stack size */
-constexpr int kStackSize = 32768*10;
+constexpr int kStackSize = Ion::k_stackSize;
 #else
 constexpr int kStackSize = 32768*10; // In DEBUG mode, we increase the stack to be able to pass the tests
 #endif
@@ -29,6 +28,9 @@ extern "C" {
 }
 
 void Ion::Timing::msleep(uint32_t ms) {
+  if (Ion::Simulator::Timing::virtualClockIsEnabled()) {
+    Ion::Simulator::Timing::advanceVirtualClock(ms);
+  }
 }
 
 int main(int argc, char * argv[]) {
@@ -39,13 +41,26 @@ int main(int argc, char * argv[]) {
       Ion::Simulator::Framebuffer::setActive(true);
       Ion::Simulator::Events::logAfter(atoi(argv[i+1]));
     }
+    if (strcmp(argv[i], "--fuzz") == 0) {
+      Ion::Simulator::Events::enableFuzzing();
+    }
+    if (strcmp(argv[i], "--branch") == 0 && argc > i+1) {
+      Ion::Simulator::Events::addBranch(argv[i+1]);
+    }
+    if (strcmp(argv[i], "--virtualClock") == 0 && argc > i+1) {
+      Ion::Simulator::Timing::enableVirtualClock(atoi(argv[i+1]));
+    }
   }
 
 #ifndef __WIN32__
   // Handle signals
   signal(SIGABRT, Ion::Simulator::Events::dumpEventCount);
 
-  // Limit stack usage
+  /* Limit stack usage. The stack of the main thread is already mapped when
+   * this runs, and lowering the limit does not shrink it, so overflowing the
+   * device stack may go unnoticed here. The check that holds is made by the
+   * quiz runner, which asserts that the painted stack usage of each case
+   * stays below Ion::k_stackSize. */
   struct rlimit stackLimits = {kStackSize, kStackSize};
   setrlimit(RLIMIT_STACK, &stackLimits);
 #endif
@@ -64,6 +79,9 @@ void init() {
 void setNeedsRefresh() {
 }
 
+void setNeedsSkinRefresh() {
+}
+
 void relayout() {
 }
 
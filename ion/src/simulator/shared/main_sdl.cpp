@@ -1,5 +1,6 @@
 #include "main.h"
 #include "display.h"
+#include "framebuffer.h"
 #include "haptics.h"
 #include "layout.h"
 #include "platform.h"
@@ -212,6 +213,61 @@ static SDL_Window * sWindow = nullptr;
 static SDL_Renderer * sRenderer = nullptr;
 static bool sNeedsRefresh = false;
 static SDL_Rect sScreenRect;
+#if !EPSILON_SDL_SCREEN_ONLY
+/* The calculator skin is rendered once into a texture, which is then simply
+ * copied on each refresh until the layout or the highlighted key changes. */
+static SDL_Texture * sSkinTexture = nullptr;
+static bool sNeedsSkinRefresh = true;
+static int sWindowWidth = 0;
+static int sWindowHeight = 0;
+
+static void recreateSkinTexture(int windowWidth, int windowHeight) {
+  sWindowWidth = windowWidth;
+  sWindowHeight = windowHeight;
+  sNeedsSkinRefresh = true;
+  int outputWidth = 0;
+  int outputHeight = 0;
+  SDL_GetRendererOutputSize(sRenderer, &outputWidth, &outputHeight);
+  if (sSkinTexture != nullptr) {
+    int textureWidth = 0;
+    int textureHeight = 0;
+    SDL_QueryTexture(sSkinTexture, nullptr, nullptr, &textureWidth, &textureHeight);
+    if (textureWidth == outputWidth && textureHeight == outputHeight) {
+      return;
+    }
+    SDL_DestroyTexture(sSkinTexture);
+    sSkinTexture = nullptr;
+  }
+  if (SDL_RenderTargetSupported(sRenderer)) {
+    // The texture has the output's size to keep the skin sharp on HiDPI screens
+    sSkinTexture = SDL_CreateTexture(sRenderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, outputWidth, outputHeight);
+  }
+}
+
+static void drawSkin() {
+  if (sSkinTexture == nullptr) {
+    // Render targets are unavailable, draw the skin on every refresh
+    SDL_SetRenderDrawColor(sRenderer, 194, 194, 194, 255);
+    SDL_RenderClear(sRenderer);
+    Layout::draw(sRenderer);
+    return;
+  }
+  if (sNeedsSkinRefresh) {
+    sNeedsSkinRefresh = false;
+    int textureWidth = 0;
+    int textureHeight = 0;
+    SDL_QueryTexture(sSkinTexture, nullptr, nullptr, &textureWidth, &textureHeight);
+    SDL_SetRenderTarget(sRenderer, sSkinTexture);
+    // The layout is expressed in window coordinates
+    SDL_RenderSetScale(sRenderer, (float)textureWidth / sWindowWidth, (float)textureHeight / sWindowHeight);
+    SDL_SetRenderDrawColor(sRenderer, 194, 194, 194, 255);
+    SDL_RenderClear(sRenderer);
+    Layout::draw(sRenderer);
+    SDL_SetRenderTarget(sRenderer, nullptr);
+  }
+  SDL_RenderCopy(sRenderer, sSkinTexture, nullptr, nullptr);
+}
+#endif
 
 void init() {
   if (SDL_Init(SDL_INIT_VIDEO) != 0) {
@@ -273,6 +329,8 @@ void relayout() {
   int windowHeight = 0;
   SDL_GetWindowSize(sWindow, &windowWidth, &windowHeight);
   SDL_RenderSetLogicalSize(sRenderer, windowWidth, windowHeight);
+  // Textures may have lost their content, upload the whole framebuffer again
+  Framebuffer::setAllDirty();
 
   #if !EPSILON_SDL_SCREEN_ONLY
   if (argument_screen_only) {
@@ -290,6 +348,7 @@ void relayout() {
     sScreenRect.y = (windowHeight - sScreenRect.h) / 2;
   } else {
     Layout::recompute(windowWidth, windowHeight);
+    recreateSkinTexture(windowWidth, windowHeight);
   }
   #else
   sScreenRect.x = 0;
@@ -305,6 +364,13 @@ void setNeedsRefresh() {
   sNeedsRefresh = true;
 }
 
+void setNeedsSkinRefresh() {
+#if !EPSILON_SDL_SCREEN_ONLY
+  sNeedsSkinRefresh = true;
+#endif
+  setNeedsRefresh();
+}
+
 void refresh() {
   if (!sNeedsRefresh) {
     return;
@@ -320,10 +386,7 @@ void refresh() {
     SDL_Rect screenRect;
     Layout::getScreenRect(&screenRect);
 
-    SDL_SetRenderDrawColor(sRenderer, 194, 194, 194, 255);
-    SDL_RenderClear(sRenderer);
-    // Can change sNeedsRefresh state if a key is highlighted and needs to be reset
-    Layout::draw(sRenderer);
+    drawSkin();
     Display::draw(sRenderer, &screenRect);
   }
   #endif
@@ -335,6 +398,8 @@ void refresh() {
 
 void quit() {
 #if !EPSILON_SDL_SCREEN_ONLY
+  SDL_DestroyTexture(sSkinTexture);
+  sSkinTexture = nullptr;
   Layout::quit();
 #endif
   Display::quit();
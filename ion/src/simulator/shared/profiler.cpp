@@ -0,0 +1,290 @@
+#include <ion/profiler.h>
+#include <ion.h>
+#include <assert.h>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unordered_map>
+#include <vector>
+#if defined(__linux__) || defined(__APPLE__)
+#include <cxxabi.h>
+#include <dlfcn.h>
+#endif
+
+namespace Ion {
+namespace Profiler {
+
+/* Time is attributed to the innermost phase being run, so that the time spent
+ * laying out views while handling an event is not counted twice. The pixels
+ * pushed to the display are attributed to the innermost drawRect call. A pixel
+ * pushed several times while handling an event is counted as overdrawn each
+ * time but the first.
+ * Events can nest: RunLoop::step is re-entered while an event is dispatched,
+ * for instance when a Python script waits for input(). The nested events are
+ * part of the outermost one, which is the only one recorded. */
+
+typedef std::chrono::steady_clock Clock;
+
+struct EventRecord {
+  uint8_t event;
+  uint64_t phaseNanoseconds[k_numberOfPhases];
+  uint64_t pixels;
+  uint64_t uniformPixels;
+  uint64_t overdrawnPixels;
+  size_t treePoolPeak;
+  size_t stackPeak;
+};
+
+struct ViewClassRecord {
+  uint64_t calls;
+  uint64_t nanoseconds;
+  uint64_t pixels;
+};
+
+class Recorder {
+public:
+  Recorder() :
+    m_numberOfOpenPhases(0),
+    m_numberOfOpenDrawRects(0),
+    m_eventDepth(0),
+    m_overdrawnPixels(0),
+    m_treePoolPeak(0),
+    m_stackPeak(0)
+  {
+    memset(m_phaseNanoseconds, 0, sizeof(m_phaseNanoseconds));
+  }
+  ~Recorder() { writeReport(); }
+
+  void beginEvent(Events::Event event) {
+    if (m_eventDepth++ > 0) {
+      return;
+    }
+    memset(&m_currentEvent, 0, sizeof(m_currentEvent));
+    m_currentEvent.event = static_cast<uint8_t>(event);
+    memset(m_pixelIsPushed, 0, sizeof(m_pixelIsPushed));
+    Ion::paintStack();
+  }
+  void endEvent() {
+    assert(m_eventDepth > 0);
+    if (--m_eventDepth > 0) {
+      return;
+    }
+    m_currentEvent.stackPeak = Ion::stackUsage();
+    if (m_currentEvent.stackPeak > m_stackPeak) {
+      m_stackPeak = m_currentEvent.stackPeak;
+    }
+    m_overdrawnPixels += m_currentEvent.overdrawnPixels;
+    m_events.push_back(m_currentEvent);
+  }
+
+  void beginPhase(Phase phase) {
+    chargeOpenPhase();
+    if (m_numberOfOpenPhases > 0 && m_openPhases[m_numberOfOpenPhases - 1].phase == phase) {
+      m_openPhases[m_numberOfOpenPhases - 1].depth++;
+      return;
+    }
+    assert(m_numberOfOpenPhases < k_maxNumberOfOpenPhases);
+    m_openPhases[m_numberOfOpenPhases++] = {phase, 1};
+  }
+  void endPhase(Phase phase) {
+    chargeOpenPhase();
+    assert(m_numberOfOpenPhases > 0 && m_openPhases[m_numberOfOpenPhases - 1].phase == phase);
+    if (--m_openPhases[m_numberOfOpenPhases - 1].depth == 0) {
+      m_numberOfOpenPhases--;
+    }
+  }
+
+  void beginDrawRect(const void * view) {
+    assert(m_numberOfOpenDrawRects < k_maxNumberOfOpenDrawRects);
+    m_openDrawRects[m_numberOfOpenDrawRects++] = {ViewClass(view), Clock::now()};
+  }
+  void endDrawRect(const void * view) {
+    assert(m_numberOfOpenDrawRects > 0 && m_openDrawRects[m_numberOfOpenDrawRects - 1].viewClass == ViewClass(view));
+    OpenDrawRect & drawRect = m_openDrawRects[--m_numberOfOpenDrawRects];
+    ViewClassRecord & record = m_viewClasses[drawRect.viewClass];
+    record.calls++;
+    record.nanoseconds += Nanoseconds(Clock::now() - drawRect.start);
+  }
+
+  void countPushedPixels(KDRect rect, bool uniform) {
+    uint64_t pixels = static_cast<uint64_t>(rect.width()) * rect.height();
+    if (eventIsOpen()) {
+      (uniform ? m_currentEvent.uniformPixels : m_currentEvent.pixels) += pixels;
+      m_currentEvent.overdrawnPixels += markPixelsAsPushed(rect);
+    }
+    if (m_numberOfOpenDrawRects > 0) {
+      m_viewClasses[m_openDrawRects[m_numberOfOpenDrawRects - 1].viewClass].pixels += pixels;
+    }
+  }
+
+  void reportTreePoolUsage(size_t size) {
+    if (eventIsOpen() && size > m_currentEvent.treePoolPeak) {
+      m_currentEvent.treePoolPeak = size;
+    }
+    if (size > m_treePoolPeak) {
+      m_treePoolPeak = size;
+    }
+  }
+
+private:
+  constexpr static int k_maxNumberOfOpenPhases = 16;
+  constexpr static int k_maxNumberOfOpenDrawRects = 16;
+  struct OpenPhase {
+    Phase phase;
+    int depth;
+  };
+  struct OpenDrawRect {
+    const void * viewClass;
+    Clock::time_point start;
+  };
+
+  static const void * ViewClass(const void * view) {
+    // Without RTTI, the virtual table is the only run-time trace of a class
+    return *reinterpret_cast<const void * const *>(view);
+  }
+  static uint64_t Nanoseconds(Clock::duration d) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+  }
+  static double Microseconds(uint64_t nanoseconds) {
+    return nanoseconds / 1000.0;
+  }
+  static void WriteClassName(FILE * f, const void * viewClass);
+
+  bool eventIsOpen() const { return m_eventDepth > 0; }
+  void chargeOpenPhase() {
+    Clock::time_point now = Clock::now();
+    if (m_numberOfOpenPhases > 0) {
+      int phase = static_cast<int>(m_openPhases[m_numberOfOpenPhases - 1].phase);
+      uint64_t elapsed = Nanoseconds(now - m_lastPhaseChange);
+      m_phaseNanoseconds[phase] += elapsed;
+      if (eventIsOpen()) {
+        m_currentEvent.phaseNanoseconds[phase] += elapsed;
+      }
+    }
+    m_lastPhaseChange = now;
+  }
+  uint64_t markPixelsAsPushed(KDRect rect) {
+    rect = rect.intersectedWith(KDRect(0, 0, Display::Width, Display::Height));
+    uint64_t alreadyPushed = 0;
+    for (int y = rect.top(); y <= rect.bottom(); y++) {
+      bool * pixel = m_pixelIsPushed + y * Display::Width + rect.left();
+      for (int x = 0; x < rect.width(); x++) {
+        alreadyPushed += pixel[x];
+        pixel[x] = true;
+      }
+    }
+    return alreadyPushed;
+  }
+  void writeReport() const;
+
+  OpenPhase m_openPhases[k_maxNumberOfOpenPhases];
+  int m_numberOfOpenPhases;
+  Clock::time_point m_lastPhaseChange;
+  OpenDrawRect m_openDrawRects[k_maxNumberOfOpenDrawRects];
+  int m_numberOfOpenDrawRects;
+  EventRecord m_currentEvent;
+  int m_eventDepth;
+  bool m_pixelIsPushed[Display::Width * Display::Height];
+  uint64_t m_overdrawnPixels;
+  std::vector<EventRecord> m_events;
+  std::unordered_map<const void *, ViewClassRecord> m_viewClasses;
+  uint64_t m_phaseNanoseconds[k_numberOfPhases];
+  size_t m_treePoolPeak;
+  size_t m_stackPeak;
+};
+
+static const char * const sPhaseNames[k_numberOfPhases] = {"eventHandling", "layout", "redraw"};
+
+void Recorder::WriteClassName(FILE * f, const void * viewClass) {
+#if defined(__linux__) || defined(__APPLE__)
+  /* Symbols are only visible to dladdr when the binary exports them, which is
+   * why profiling builds are linked with -rdynamic. */
+  Dl_info info;
+  if (dladdr(viewClass, &info) != 0) {
+    if (info.dli_sname != nullptr) {
+      int status = -1;
+      char * demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+      if (status == 0) {
+        const char * prefix = "vtable for ";
+        size_t prefixLength = strlen(prefix);
+        fprintf(f, "%s", strncmp(demangled, prefix, prefixLength) == 0 ? demangled + prefixLength : demangled);
+      } else {
+        fprintf(f, "%s", info.dli_sname);
+      }
+      free(demangled);
+      return;
+    }
+    fprintf(f, "vtable+0x%zx", static_cast<size_t>(static_cast<const char *>(viewClass) - static_cast<const char *>(info.dli_fbase)));
+    return;
+  }
+#endif
+  fprintf(f, "%p", viewClass);
+}
+
+void Recorder::writeReport() const {
+  if (m_events.empty() && m_viewClasses.empty()) {
+    return;
+  }
+  const char * path = getenv("EPSILON_PROFILE_OUTPUT");
+  if (path == nullptr) {
+    path = "epsilon_profile.json";
+  }
+  FILE * f = fopen(path, "w");
+  if (f == nullptr) {
+    return;
+  }
+  // Times are in microseconds
+  fprintf(f, "{\n  \"treePoolPeak\": %zu,\n  \"stackPeak\": %zu,\n  \"overdrawnPixels\": %llu,\n  \"phases\": {",
+      m_treePoolPeak,
+      m_stackPeak,
+      static_cast<unsigned long long>(m_overdrawnPixels));
+  for (int i = 0; i < k_numberOfPhases; i++) {
+    fprintf(f, "%s\"%s\": %.3f", i == 0 ? "" : ", ", sPhaseNames[i], Microseconds(m_phaseNanoseconds[i]));
+  }
+  fprintf(f, "},\n  \"events\": [");
+  for (size_t i = 0; i < m_events.size(); i++) {
+    const EventRecord & e = m_events[i];
+    fprintf(f, "%s\n    {\"event\": %d, ", i == 0 ? "" : ",", e.event);
+#ifndef NDEBUG
+    const char * name = Events::Event(e.event).name();
+    fprintf(f, "\"name\": \"%s\", ", name != nullptr ? name : "UNDEFINED");
+#endif
+    for (int j = 0; j < k_numberOfPhases; j++) {
+      fprintf(f, "\"%s\": %.3f, ", sPhaseNames[j], Microseconds(e.phaseNanoseconds[j]));
+    }
+    fprintf(f, "\"pixels\": %llu, \"uniformPixels\": %llu, \"overdrawnPixels\": %llu, \"treePoolPeak\": %zu, \"stackPeak\": %zu}",
+        static_cast<unsigned long long>(e.pixels),
+        static_cast<unsigned long long>(e.uniformPixels),
+        static_cast<unsigned long long>(e.overdrawnPixels),
+        e.treePoolPeak,
+        e.stackPeak);
+  }
+  fprintf(f, "\n  ],\n  \"views\": [");
+  bool first = true;
+  for (const auto & v : m_viewClasses) {
+    fprintf(f, "%s\n    {\"class\": \"", first ? "" : ",");
+    WriteClassName(f, v.first);
+    fprintf(f, "\", \"drawRectCalls\": %llu, \"drawRect\": %.3f, \"pixels\": %llu}",
+        static_cast<unsigned long long>(v.second.calls),
+        Microseconds(v.second.nanoseconds),
+        static_cast<unsigned long long>(v.second.pixels));
+    first = false;
+  }
+  fprintf(f, "\n  ]\n}\n");
+  fclose(f);
+}
+
+static Recorder sRecorder;
+
+void beginEvent(Events::Event event) { sRecorder.beginEvent(event); }
+void endEvent() { sRecorder.endEvent(); }
+void beginPhase(Phase phase) { sRecorder.beginPhase(phase); }
+void endPhase(Phase phase) { sRecorder.endPhase(phase); }
+void beginDrawRect(const void * view) { sRecorder.beginDrawRect(view); }
+void endDrawRect(const void * view) { sRecorder.endDrawRect(view); }
+void countPushedPixels(KDRect rect, bool uniform) { sRecorder.countPushedPixels(rect, uniform); }
+void reportTreePoolUsage(size_t size) { sRecorder.reportTreePoolUsage(size); }
+
+}
+}
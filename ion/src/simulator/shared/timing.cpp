@@ -1,9 +1,42 @@
+#include "timing.h"
 #include <ion.h>
 #include <chrono>
 
 static auto start = std::chrono::steady_clock::now();
+static bool sVirtualClockIsEnabled = false;
+static uint32_t sVirtualEventInterval = 0;
+static uint64_t sVirtualTime = 0;
 
 uint64_t Ion::Timing::millis() {
+  if (sVirtualClockIsEnabled) {
+    return sVirtualTime;
+  }
   auto elapsed = std::chrono::steady_clock::now() - start;
   return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
 }
+
+namespace Ion {
+namespace Simulator {
+namespace Timing {
+
+void enableVirtualClock(uint32_t eventInterval) {
+  sVirtualClockIsEnabled = true;
+  sVirtualEventInterval = eventInterval;
+  sVirtualTime = 0;
+}
+
+bool virtualClockIsEnabled() {
+  return sVirtualClockIsEnabled;
+}
+
+uint32_t virtualEventInterval() {
+  return sVirtualEventInterval;
+}
+
+void advanceVirtualClock(uint32_t ms) {
+  sVirtualTime += ms;
+}
+
+}
+}
+}
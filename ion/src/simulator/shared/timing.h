@@ -0,0 +1,24 @@
+#ifndef ION_SIMULATOR_TIMING_H
+#define ION_SIMULATOR_TIMING_H
+
+#include <stdint.h>
+
+namespace Ion {
+namespace Simulator {
+namespace Timing {
+
+/* The virtual clock replaces the host clock to make headless runs
+ * reproducible. It only advances when sleeping and while waiting for the next
+ * event, which arrives eventInterval milliseconds after the previous one.
+ * Waiting takes no actual time, so timers fire as if the events had been
+ * typed at that pace. */
+void enableVirtualClock(uint32_t eventInterval);
+bool virtualClockIsEnabled();
+uint32_t virtualEventInterval();
+void advanceVirtualClock(uint32_t ms);
+
+}
+}
+}
+
+#endif
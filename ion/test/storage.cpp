@@ -500,3 +500,28 @@ aaaaaa)";
   retrievedRecord3.destroy();
   retrievedRecord4.destroy();
 }
+
+QUIZ_CASE(ion_storage_checksum_of_records_with_extensions) {
+  const char * extensions[] = {"record1", "record2"};
+  uint32_t initialChecksum = Storage::sharedStorage()->checksumOfRecordsWithExtensions(extensions, 2);
+
+  Storage::Record::ErrorStatus error = putRecordInSharedStorage("ionTestStorage1", "record1", "Checked");
+  quiz_assert(error == Storage::Record::ErrorStatus::None);
+  uint32_t checksumWithRecord1 = Storage::sharedStorage()->checksumOfRecordsWithExtensions(extensions, 2);
+  quiz_assert(checksumWithRecord1 != initialChecksum);
+
+  // Records with other extensions are ignored
+  error = putRecordInSharedStorage("ionTestStorage2", "record3", "Ignored");
+  quiz_assert(error == Storage::Record::ErrorStatus::None);
+  quiz_assert(Storage::sharedStorage()->checksumOfRecordsWithExtensions(extensions, 2) == checksumWithRecord1);
+
+  // Modifying a checked record changes the checksum
+  Storage::Record record1 = Storage::sharedStorage()->recordBaseNamedWithExtension("ionTestStorage1", "record1");
+  error = record1.setValue({.buffer = "Changed", .size = strlen("Changed")});
+  quiz_assert(error == Storage::Record::ErrorStatus::None);
+  quiz_assert(Storage::sharedStorage()->checksumOfRecordsWithExtensions(extensions, 2) != checksumWithRecord1);
+
+  record1.destroy();
+  Storage::sharedStorage()->recordBaseNamedWithExtension("ionTestStorage2", "record3").destroy();
+  quiz_assert(Storage::sharedStorage()->checksumOfRecordsWithExtensions(extensions, 2) == initialChecksum);
+}
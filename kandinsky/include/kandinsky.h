@@ -2,6 +2,7 @@
 #define KANDINSKY_KANDINSKY_H
 
 #include <kandinsky/color.h>
+#include <kandinsky/color_lookup_table.h>
 #include <kandinsky/coordinate.h>
 #include <kandinsky/context.h>
 #include <kandinsky/font.h>
@@ -11,7 +12,6 @@
 #include <kandinsky/point.h>
 #include <kandinsky/postprocess_context.h>
 #include <kandinsky/postprocess_gamma_context.h>
-#include <kandinsky/postprocess_invert_context.h>
 #include <kandinsky/postprocess_zoom_context.h>
 #include <kandinsky/rect.h>
 #include <kandinsky/size.h>
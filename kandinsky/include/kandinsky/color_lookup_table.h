@@ -0,0 +1,33 @@
+#ifndef KANDINSKY_COLOR_LOOKUP_TABLE_H
+#define KANDINSKY_COLOR_LOOKUP_TABLE_H
+
+#include <kandinsky/color.h>
+
+/* The post-processing color effects act on each channel independently: they
+ * are precomputed for the 32 red, 64 green and 32 blue values of an RGB565
+ * color. The tables store the transformed channels already shifted in place,
+ * so that transforming a color costs three lookups. The reverse tables undo
+ * the effects on pulled pixels. */
+
+class KDColorLookupTable {
+public:
+  KDColorLookupTable();
+  // Gammas range from -MaxGammaStates to MaxGammaStates, 0 being neutral
+  void set(int redGamma, int greenGamma, int blueGamma, bool invert);
+  KDColor apply(KDColor color) const { return lookUp(m_table, color); }
+  KDColor applyReverse(KDColor color) const { return lookUp(m_reverseTable, color); }
+  constexpr static int MaxGammaStates = 7;
+private:
+  constexpr static int k_redOffset = 0;
+  constexpr static int k_greenOffset = 32;
+  constexpr static int k_blueOffset = 32 + 64;
+  constexpr static int k_tableSize = 32 + 64 + 32;
+  static KDColor lookUp(const uint16_t * table, KDColor color) {
+    uint16_t c = color;
+    return KDColor::RGB16(table[k_redOffset + (c >> 11)] | table[k_greenOffset + ((c >> 5) & 0x3F)] | table[k_blueOffset + (c & 0x1F)]);
+  }
+  uint16_t m_table[k_tableSize];
+  uint16_t m_reverseTable[k_tableSize];
+};
+
+#endif
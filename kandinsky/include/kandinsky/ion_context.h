@@ -3,7 +3,6 @@
 
 #include <kandinsky/context.h>
 #include <kandinsky/postprocess_gamma_context.h>
-#include <kandinsky/postprocess_invert_context.h>
 #include <kandinsky/postprocess_zoom_context.h>
 
 class KDRealIonContext : public KDContext {
@@ -19,8 +18,8 @@ public:
   static KDIonContext * sharedContext();
   void updatePostProcessingEffects();
 
-  KDPostProcessInvertContext invert;
   KDPostProcessZoomContext zoom;
+  // Applies both the gamma correction and the inversion
   KDPostProcessGammaContext gamma;
   bool invertEnabled;
   bool zoomEnabled;
@@ -2,6 +2,10 @@
 #define KANDINSKY_POSTPROCESS_GAMMA_CONTEXT_H
 
 #include <kandinsky/postprocess_context.h>
+#include <kandinsky/color_lookup_table.h>
+
+/* Applies the color effects, gamma correction and inversion, in a single pass
+ * through a lookup table. */
 
 class KDPostProcessGammaContext : public KDPostProcessContext {
 public:
@@ -9,11 +13,14 @@ public:
   void gamma(float& red, float& green, float& blue);
   void gamma(int& red, int& green, int& blue);
   void setGamma(int red, int green, int blue);
+  void updateColorTable(bool gammaEnabled, bool invertEnabled);
+  const KDColorLookupTable * colorTable() const { return &m_colorTable; }
 private:
   void pushRect(KDRect rect, const KDColor * pixels) override;
   void pushRectUniform(KDRect rect, KDColor color) override;
   void pullRect(KDRect rect, KDColor * pixels) override;
   int m_redGamma, m_greenGamma, m_blueGamma;
+  KDColorLookupTable m_colorTable;
 };
 
 #endif
@@ -2,6 +2,7 @@
 #define KANDINSKY_POSTPROCESS_ZOOM_CONTEXT_H
 
 #include <kandinsky/postprocess_context.h>
+#include <kandinsky/color_lookup_table.h>
 
 class KDPostProcessZoomContext : public KDPostProcessContext {
 public:
@@ -10,11 +11,14 @@ public:
   void setViewingArea(KDRect viewingArea) { m_viewingArea = viewingArea; }
   KDRect targetArea() const { return m_targetArea; }
   void setTargetArea(KDRect targetArea) { m_targetArea = targetArea; }
+  // The color effects are applied while resampling, if any
+  void setColorTable(const KDColorLookupTable * colorTable) { m_colorTable = colorTable; }
 private:
   void pushRect(KDRect rect, const KDColor * pixels) override;
   void pushRectUniform(KDRect rect, KDColor color) override;
   void pullRect(KDRect rect, KDColor * pixels) override;
   KDRect m_viewingArea, m_targetArea;
+  const KDColorLookupTable * m_colorTable;
 };
 
 #endif
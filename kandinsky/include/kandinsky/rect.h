@@ -63,6 +63,13 @@ public:
   KDRect intersectedWith(const KDRect & other) const;
   KDRect unionedWith(const KDRect & other) const; // Returns the smallest rectangle containing r1 and r2
   KDRect differencedWith(const KDRect & other) const; // Returns the smallest rectangle containing r1\r2
+  /* Splits r1\r2 into at most k_maxNumberOfPiecesOfSubtraction disjoint
+   * rectangles: the bands above and below r2, spanning the width of r1, and
+   * the bands on the left and on the right of r2. Returns their number.
+   * KDRect has no default constructor: arrays of pieces are initialized with
+   * KDRectZero. */
+  constexpr static int k_maxNumberOfPiecesOfSubtraction = 4;
+  int subtractedBy(const KDRect & other, KDRect pieces[k_maxNumberOfPiecesOfSubtraction]) const;
   bool contains(KDPoint p) const;
   bool containsRect(const KDRect & other) const;
   bool isAbove(KDPoint p) const;
@@ -0,0 +1,37 @@
+#include <kandinsky/color_lookup_table.h>
+#include <assert.h>
+#include <math.h>
+
+constexpr float MaxGammaGamut = 0.75;
+
+static float toGamma(int gamma) {
+  return 1.f / (1 + (float(gamma) / KDColorLookupTable::MaxGammaStates * MaxGammaGamut));
+}
+
+/* Fill the table of a channel of numberOfBits bits, located at shift in an
+ * RGB565 color. The gamma is applied on the 8-bit value of the channel, like
+ * KDColor::red() and KDColor::RGB888 convert it. */
+static void fillChannel(uint16_t * table, uint16_t * reverseTable, int numberOfBits, int shift, float gamma, bool invert) {
+  int maxValue = (1 << numberOfBits) - 1;
+  int unusedBits = 8 - numberOfBits;
+  for (int value = 0; value <= maxValue; value++) {
+    // Push: apply the gamma, then invert
+    uint8_t corrected = powf((value << unusedBits) / 255.f, gamma) * 255;
+    int pushed = corrected >> unusedBits;
+    table[value] = (invert ? maxValue - pushed : pushed) << shift;
+    // Pull: invert, then undo the gamma
+    int pulled = invert ? maxValue - value : value;
+    uint8_t uncorrected = powf((pulled << unusedBits) / 255.f, 1.f / gamma) * 255;
+    reverseTable[value] = (uncorrected >> unusedBits) << shift;
+  }
+}
+
+KDColorLookupTable::KDColorLookupTable() {
+  set(0, 0, 0, false);
+}
+
+void KDColorLookupTable::set(int redGamma, int greenGamma, int blueGamma, bool invert) {
+  fillChannel(m_table + k_redOffset, m_reverseTable + k_redOffset, 5, 11, toGamma(redGamma), invert);
+  fillChannel(m_table + k_greenOffset, m_reverseTable + k_greenOffset, 6, 5, toGamma(greenGamma), invert);
+  fillChannel(m_table + k_blueOffset, m_reverseTable + k_blueOffset, 5, 0, toGamma(blueGamma), invert);
+}
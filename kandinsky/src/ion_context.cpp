@@ -18,18 +18,20 @@ KDIonContext * KDIonContext::sharedContext() {
 }
 
 void KDIonContext::updatePostProcessingEffects() {
+  /* The effects are fused in a single pass: the color effects are looked up
+   * in a table, while resampling if zooming. */
   rootContext = &m_realContext;
-  if (invertEnabled) {
-    invert.setTarget(rootContext);
-    rootContext = &invert;
+  bool colorEnabled = invertEnabled || gammaEnabled;
+  if (colorEnabled) {
+    gamma.updateColorTable(gammaEnabled, invertEnabled);
   }
   if (zoomEnabled && !zoomInhibit) {
     zoom.setTarget(rootContext);
     zoom.setTargetArea(KDRect(0,0,320,240));
     zoom.setViewingArea(KDRect(80*(zoomPosition%3),120-60*(zoomPosition/3),160,120));
+    zoom.setColorTable(colorEnabled ? gamma.colorTable() : nullptr);
     rootContext = &zoom;
-  }
-  if (gammaEnabled) {
+  } else if (colorEnabled) {
     gamma.setTarget(rootContext);
     rootContext = &gamma;
   }
@@ -1,13 +1,7 @@
 #include <kandinsky/postprocess_gamma_context.h>
 #include <ion.h>
-#include <math.h>
 
-constexpr int MaxGammaStates = 7;
-constexpr float MaxGammaGamut = 0.75;
-
-constexpr float toGamma(int gamma) {
-  return 1.f / (1 + (float(gamma) / MaxGammaStates * MaxGammaGamut));
-}
+constexpr int MaxGammaStates = KDColorLookupTable::MaxGammaStates;
 
 constexpr int clampGamma(int gamma) {
   return gamma < -MaxGammaStates ? -MaxGammaStates : (gamma > MaxGammaStates ? MaxGammaStates : gamma);
@@ -34,52 +28,36 @@ void KDPostProcessGammaContext::setGamma(int red, int green, int blue) {
   m_blueGamma = clampGamma(blue);
 }
 
+void KDPostProcessGammaContext::updateColorTable(bool gammaEnabled, bool invertEnabled) {
+  if (gammaEnabled) {
+    m_colorTable.set(m_redGamma, m_greenGamma, m_blueGamma, invertEnabled);
+  } else {
+    m_colorTable.set(0, 0, 0, invertEnabled);
+  }
+}
+
 void KDPostProcessGammaContext::pushRect(KDRect rect, const KDColor * pixels) {
-  const float redGamma = toGamma(m_redGamma);
-  const float greenGamma = toGamma(m_greenGamma);
-  const float blueGamma = toGamma(m_blueGamma);
   KDColor workingBuffer[rect.width()];
 
   for (KDCoordinate y = 0; y < rect.height(); y++) {
     KDRect workingRect(rect.x(), rect.y()+y, rect.width(), 1);
   
     for (KDCoordinate x = 0; x < rect.width(); x++) {
-      const KDColor color = pixels[y*rect.width()+x];
-      const KDColor result = KDColor::RGB888(
-        (uint8_t)(powf(color.red()/255.f, redGamma)*255),
-        (uint8_t)(powf(color.green()/255.f, greenGamma)*255),
-        (uint8_t)(powf(color.blue()/255.f, blueGamma)*255));
-      workingBuffer[x] = result;
+      workingBuffer[x] = m_colorTable.apply(pixels[y*rect.width()+x]);
     }
     KDPostProcessContext::pushRect(workingRect, workingBuffer);
   }
 }
 
 void KDPostProcessGammaContext::pushRectUniform(KDRect rect, KDColor color) {
-  const float redGamma = toGamma(m_redGamma);
-  const float greenGamma = toGamma(m_greenGamma);
-  const float blueGamma = toGamma(m_blueGamma);
-  const KDColor result = KDColor::RGB888(
-      (uint8_t)(powf(color.red()/255.f, redGamma)*255),
-      (uint8_t)(powf(color.green()/255.f, greenGamma)*255),
-      (uint8_t)(powf(color.blue()/255.f, blueGamma)*255));
-
-  KDPostProcessContext::pushRectUniform(rect, result);
+  KDPostProcessContext::pushRectUniform(rect, m_colorTable.apply(color));
 }
 
 void KDPostProcessGammaContext::pullRect(KDRect rect, KDColor * pixels) {
-  const float redGamma = 1.f/toGamma(m_redGamma);
-  const float greenGamma = 1.f/toGamma(m_greenGamma);
-  const float blueGamma = 1.f/toGamma(m_blueGamma);
   KDPostProcessContext::pullRect(rect, pixels);
   for (KDCoordinate y = 0; y < rect.height(); y++) {
     for (KDCoordinate x = 0; x < rect.width(); x++) {
-      const KDColor color = pixels[y*rect.width()+x];
-      const KDColor result = KDColor::RGB888(
-          (uint8_t)(powf(color.red()/255.f, redGamma)*255),
-          (uint8_t)(powf(color.green()/255.f,greenGamma)*255),
-          (uint8_t)(powf(color.blue()/255.f, blueGamma)*255));
-      pixels[y*rect.width()+x] = result;
+      pixels[y*rect.width()+x] = m_colorTable.applyReverse(pixels[y*rect.width()+x]);
     }
   }
 }
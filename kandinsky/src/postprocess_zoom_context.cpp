@@ -1,7 +1,7 @@
 #include <kandinsky/postprocess_zoom_context.h>
 #include <ion.h>
 
-KDPostProcessZoomContext::KDPostProcessZoomContext() : m_viewingArea(KDRectZero), m_targetArea(KDRectZero)
+KDPostProcessZoomContext::KDPostProcessZoomContext() : m_viewingArea(KDRectZero), m_targetArea(KDRectZero), m_colorTable(nullptr)
 {
 }
 
@@ -13,8 +13,14 @@ void KDPostProcessZoomContext::pushRect(KDRect rect, const KDColor * pixels) {
   KDColor targetBuffer[targetRect.width()];
 
   for (int y = 0; y < rect.height(); y++) {
-    for (int x = 0; x < rect.width(); x++) {
-      targetBuffer[2*x+1] = targetBuffer[2*x] = pixels[y*rect.width()+x];
+    if (m_colorTable) {
+      for (int x = 0; x < rect.width(); x++) {
+        targetBuffer[2*x+1] = targetBuffer[2*x] = m_colorTable->apply(pixels[y*rect.width()+x]);
+      }
+    } else {
+      for (int x = 0; x < rect.width(); x++) {
+        targetBuffer[2*x+1] = targetBuffer[2*x] = pixels[y*rect.width()+x];
+      }
     }
 
     for (int i = 0; i < 2; i++) {
@@ -30,7 +36,7 @@ void KDPostProcessZoomContext::pushRectUniform(KDRect rect, KDColor color) {
   targetRect = targetRect.translatedBy(KDPoint(-m_viewingArea.x()*2,-m_viewingArea.y()*2));
   targetRect = m_targetArea.intersectedWith(targetRect);
 
-  KDPostProcessContext::pushRectUniform(targetRect, color);
+  KDPostProcessContext::pushRectUniform(targetRect, m_colorTable ? m_colorTable->apply(color) : color);
 }
 
 void KDPostProcessZoomContext::pullRect(KDRect rect, KDColor * pixels) {
@@ -47,7 +53,7 @@ void KDPostProcessZoomContext::pullRect(KDRect rect, KDColor * pixels) {
     KDPostProcessContext::pullRect(outputRect, targetBuffer+(clippedTargetRect.x()-targetRect.x()));
 
     for (int x = 0; x < rect.width(); x++) {
-      pixels[y*rect.width()+x] = targetBuffer[x*2];
+      pixels[y*rect.width()+x] = m_colorTable ? m_colorTable->applyReverse(targetBuffer[x*2]) : targetBuffer[x*2];
     }
   }
 }
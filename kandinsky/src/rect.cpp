@@ -143,6 +143,31 @@ KDRect KDRect::differencedWith(const KDRect & other) const {
     );
 }
 
+int KDRect::subtractedBy(const KDRect & other, KDRect pieces[k_maxNumberOfPiecesOfSubtraction]) const {
+  if (isEmpty()) {
+    return 0;
+  }
+  KDRect intersection = intersectedWith(other);
+  if (intersection.isEmpty()) {
+    pieces[0] = *this;
+    return 1;
+  }
+  int numberOfPieces = 0;
+  if (intersection.top() > top()) {
+    pieces[numberOfPieces++] = KDRect(left(), top(), width(), intersection.top() - top());
+  }
+  if (intersection.bottom() < bottom()) {
+    pieces[numberOfPieces++] = KDRect(left(), intersection.bottom() + 1, width(), bottom() - intersection.bottom());
+  }
+  if (intersection.left() > left()) {
+    pieces[numberOfPieces++] = KDRect(left(), intersection.top(), intersection.left() - left(), intersection.height());
+  }
+  if (intersection.right() < right()) {
+    pieces[numberOfPieces++] = KDRect(intersection.right() + 1, intersection.top(), right() - intersection.right(), intersection.height());
+  }
+  return numberOfPieces;
+}
+
 bool KDRect::contains(KDPoint p) const {
   return (p.x() >= x() && p.x() <= right() && p.y() >= y() && p.y() <= bottom());
 }
@@ -1,6 +1,7 @@
 #include <quiz.h>
 #include <kandinsky.h>
 #include <assert.h>
+#include <math.h>
 
 QUIZ_CASE(kandinsky_color_rgb) {
   quiz_assert(sizeof(KDColor) == 2); // We really want KDColor to be packed
@@ -39,3 +40,36 @@ QUIZ_CASE(kandinsky_color_blend) {
     assert_colors_blend_to(color, color, col>>8, color);
   }
 }
+
+static float toGamma(int gamma) {
+  return 1.f / (1 + (float(gamma) / KDColorLookupTable::MaxGammaStates * 0.75f));
+}
+
+static KDColor gammaCorrected(KDColor color, float redGamma, float greenGamma, float blueGamma) {
+  return KDColor::RGB888(
+      (uint8_t)(powf(color.red()/255.f, redGamma)*255),
+      (uint8_t)(powf(color.green()/255.f, greenGamma)*255),
+      (uint8_t)(powf(color.blue()/255.f, blueGamma)*255));
+}
+
+void assert_color_lookup_table_matches_effects(int redGamma, int greenGamma, int blueGamma, bool invert) {
+  KDColorLookupTable table;
+  table.set(redGamma, greenGamma, blueGamma, invert);
+  float r = toGamma(redGamma);
+  float g = toGamma(greenGamma);
+  float b = toGamma(blueGamma);
+  for (uint32_t c = 0; c <= 0xFFFF; c++) {
+    KDColor color = KDColor::RGB16(c);
+    KDColor pushed = gammaCorrected(color, r, g, b);
+    KDColor pulled = gammaCorrected(invert ? color.invert() : color, 1.f/r, 1.f/g, 1.f/b);
+    quiz_assert(table.apply(color) == (invert ? pushed.invert() : pushed));
+    quiz_assert(table.applyReverse(color) == pulled);
+  }
+}
+
+QUIZ_CASE(kandinsky_color_lookup_table) {
+  assert_color_lookup_table_matches_effects(0, 0, 0, false);
+  assert_color_lookup_table_matches_effects(0, 0, 0, true);
+  assert_color_lookup_table_matches_effects(3, -2, 7, false);
+  assert_color_lookup_table_matches_effects(-7, 5, 1, true);
+}
@@ -77,3 +77,32 @@ QUIZ_CASE(kandinsky_rect_difference) {
   t = a.differencedWith(d);
   quiz_assert(t == KDRect(-1, 0, 8, 2));
 }
+
+QUIZ_CASE(kandinsky_rect_subtraction) {
+  KDRect a(0, 0, 10, 8);
+  KDRect pieces[KDRect::k_maxNumberOfPiecesOfSubtraction] = {KDRectZero, KDRectZero, KDRectZero, KDRectZero};
+
+  // Disjoint rectangles
+  quiz_assert(a.subtractedBy(KDRect(20, 0, 5, 5), pieces) == 1);
+  quiz_assert(pieces[0] == a);
+
+  // Covering rectangle
+  quiz_assert(a.subtractedBy(KDRect(-1, -1, 12, 10), pieces) == 0);
+
+  // Band on one side
+  quiz_assert(a.subtractedBy(KDRect(-2, -2, 20, 5), pieces) == 1);
+  quiz_assert(pieces[0] == KDRect(0, 3, 10, 5));
+
+  // Hole in the middle
+  quiz_assert(a.subtractedBy(KDRect(2, 3, 4, 2), pieces) == 4);
+  quiz_assert(pieces[0] == KDRect(0, 0, 10, 3));
+  quiz_assert(pieces[1] == KDRect(0, 5, 10, 3));
+  quiz_assert(pieces[2] == KDRect(0, 3, 2, 2));
+  quiz_assert(pieces[3] == KDRect(6, 3, 4, 2));
+  int area = 0;
+  for (int i = 0; i < 4; i++) {
+    quiz_assert(!pieces[i].intersects(KDRect(2, 3, 4, 2)));
+    area += pieces[i].width() * pieces[i].height();
+  }
+  quiz_assert(area == 10 * 8 - 4 * 2);
+}
@@ -22,6 +22,16 @@ namespace ApproximationHelper {
   template <typename T> using MatrixAndMatrixReduction = MatrixComplex<T>(*)(const MatrixComplex<T> m, const MatrixComplex<T> n, Preferences::ComplexFormat complexFormat);
   template<typename T> Evaluation<T> MapReduce(const ExpressionNode * expression, ExpressionNode::ApproximationContext approximationContext, ComplexAndComplexReduction<T> computeOnComplexes, ComplexAndMatrixReduction<T> computeOnComplexAndMatrix, MatrixAndComplexReduction<T> computeOnMatrixAndComplex, MatrixAndMatrixReduction<T> computeOnMatrices);
 
+  /* Scalar versions of Map and MapReduce, used by approximateToComplex. They
+   * return false as soon as an operand is not scalar. */
+  template <typename T> using ScalarCompute = std::complex<T>(*)(const std::complex<T>, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
+  template<typename T> bool MapToComplex(const ExpressionNode * expression, ExpressionNode::ApproximationContext approximationContext, ScalarCompute<T> compute, std::complex<T> * result);
+  template <typename T> using ScalarReduction = std::complex<T>(*)(const std::complex<T>, const std::complex<T>, Preferences::ComplexFormat complexFormat);
+  template<typename T> bool MapReduceToComplex(const ExpressionNode * expression, ExpressionNode::ApproximationContext approximationContext, ScalarReduction<T> computeOnComplexes, std::complex<T> * result);
+  /* Same as expression->approximate(...).toScalar(), without building
+   * evaluations for the scalar subtrees. */
+  template<typename T> T ApproximateToScalar(const ExpressionNode * expression, ExpressionNode::ApproximationContext approximationContext);
+
   template<typename T> MatrixComplex<T> ElementWiseOnMatrixComplexAndComplex(const MatrixComplex<T> n, std::complex<T> c, Preferences::ComplexFormat complexFormat, ComplexAndComplexReduction<T> computeOnComplexes);
   template<typename T> MatrixComplex<T> ElementWiseOnComplexMatrices(const MatrixComplex<T> m, const MatrixComplex<T> n, Preferences::ComplexFormat complexFormat, ComplexAndComplexReduction<T> computeOnComplexes);
 };
@@ -16,23 +16,55 @@ public:
   static int LCM(int i, int j);
   template<typename T> static Evaluation<T> GCD(const ExpressionNode & expressionNode, ExpressionNode::ApproximationContext approximationContext);
   template<typename T> static Evaluation<T> LCM(const ExpressionNode & expressionNode, ExpressionNode::ApproximationContext approximationContext);
-  /* When outputCoefficients[0] is set to -1, that indicates a special case:
-   * i could not be factorized.
-   * Before calling PrimeFactorization, we initiate two tables of Integers
-   * (outputFactors & outputCoefficients) of length k_maxNumberOfPrimeFactors = 32.
-   * As explained in 'integer.h', we guarantee the existence of only 16 Integers
-   * simultaneously. However, primeFactors are capped by
-   * k_biggestPrimeFactor*k_biggestPrimeFactor and they thus benefit from the
-   * small integer optimization. Thereby, the tables will not allocate any
-   * Integer on the static Integer table that limit the number of Integer
-   * simultaneously alive. */
-  static int PrimeFactorization(const Integer & i, Integer outputFactors[], Integer outputCoefficients[], int outputLength);
+  /* PrimeFactorization returns the number of prime factors of i, or a
+   * negative number when i could not be factorized (-1 if it might have too
+   * many factors, -2 if they are too big).
+   * The tables outputFactors & outputCoefficients are of length
+   * k_maxNumberOfPrimeFactors = 32. Factors are capped by
+   * k_biggestPrimeFactor*k_biggestPrimeFactor, and coefficients by 255 as i is
+   * lower than the primorial of the 32nd prime. They are thus output as native
+   * integers rather than as Integers, which keeps the tables small on the
+   * stack of the reductions calling PrimeFactorization. */
+  static int PrimeFactorization(const Integer & i, uint32_t outputFactors[], uint8_t outputCoefficients[], int outputLength);
+  /* The last factorizations are memoized, since the same integers are often
+   * factorized several times during a reduction and its display. The cache
+   * lives outside of the pool and is emptied by Poincare::Tidy when the pool
+   * runs short of memory. */
+  static void ResetPrimeFactorizationCache();
   constexpr static int k_numberOfPrimeFactors = 1000;
   constexpr static int k_maxNumberOfPrimeFactors = 32;
 private:
   /* When decomposing an integer into primes factors, we look for its prime
    * factors among integer from 2 to 10000. */
   constexpr static int k_biggestPrimeFactor = 10000;
+  static int ComputePrimeFactorization(const Integer & i, uint32_t outputFactors[], uint8_t outputCoefficients[]);
+
+  class PrimeFactorizationCache {
+  public:
+    /* Factorized integers are lower than the primorial of the 32nd prime, so
+     * they fit in 6 digits. */
+    constexpr static int k_maxNumberOfDigits = 6;
+    // Return the number of factors, or k_notCached
+    int get(const Integer & i, uint32_t outputFactors[], uint8_t outputCoefficients[]) const;
+    void set(const Integer & i, int numberOfFactors, const uint32_t factors[], const uint8_t coefficients[]);
+    void reset();
+    constexpr static int k_notCached = -128;
+  private:
+    constexpr static int k_numberOfEntries = 4;
+    struct Entry {
+      native_uint_t digits[k_maxNumberOfDigits];
+      uint8_t numberOfDigits; // 0 for empty entries
+      int8_t numberOfFactors;
+      uint8_t coefficients[k_maxNumberOfPrimeFactors];
+      /* Factors are lower than k_biggestPrimeFactor except for the last one,
+       * which is lower than k_biggestPrimeFactor^2. */
+      uint32_t factors[k_maxNumberOfPrimeFactors];
+    };
+    bool entryMatches(const Entry & entry, const Integer & i) const;
+    Entry m_entries[k_numberOfEntries];
+    int m_nextEntryToReplace;
+  };
+  static PrimeFactorizationCache s_primeFactorizationCache;
 };
 
 }
@@ -36,6 +36,14 @@ public:
   // Approximation
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return Complex<float>::Builder(templatedApproximate<float>()); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return Complex<double>::Builder(templatedApproximate<double>()); }
+  bool approximateToComplex(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override {
+    *result = ComplexNode<float>::Normalize(templatedApproximate<float>());
+    return true;
+  }
+  bool approximateToComplex(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override {
+    *result = ComplexNode<double>::Normalize(templatedApproximate<double>());
+    return true;
+  }
   template<typename T> T templatedApproximate() const;
 
 private:
@@ -33,6 +33,7 @@ private:
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<double>(approximationContext); }
   template<typename T> Complex<T> templatedApproximate(ApproximationContext approximationContext) const;
+  constexpr static int k_maxNumberOfFactors = 1000;
 };
 
 class BinomialCoefficient final : public Expression {
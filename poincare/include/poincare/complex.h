@@ -12,6 +12,10 @@ template<typename T>
 class ComplexNode final : public EvaluationNode<T>, public std::complex<T> {
 public:
   ComplexNode(std::complex<T> c);
+  /* Normalize has the side effects of building a Complex: it flags the
+   * approximation as complex and turns -0 into 0. Scalar approximations apply
+   * it to their results to stay identical to evaluations. */
+  static std::complex<T> Normalize(std::complex<T> c);
 
   // TreeNode
   size_t size() const override { return sizeof(ComplexNode<T>); }
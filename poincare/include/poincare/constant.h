@@ -1,6 +1,7 @@
 #ifndef POINCARE_CONSTANT_H
 #define POINCARE_CONSTANT_H
 
+#include <poincare/complex.h>
 #include <poincare/symbol_abstract.h>
 
 namespace Poincare {
@@ -36,6 +37,14 @@ public:
   /* Approximation */
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<float>(); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<double>(); }
+  bool approximateToComplex(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override {
+    *result = ComplexNode<float>::Normalize(templatedApproximateToComplex<float>());
+    return true;
+  }
+  bool approximateToComplex(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override {
+    *result = ComplexNode<double>::Normalize(templatedApproximateToComplex<double>());
+    return true;
+  }
 
   /* Symbol properties */
   bool isPi() const { return isConstantCodePoint(UCodePointGreekSmallLetterPi); }
@@ -57,7 +66,8 @@ private:
   char m_name[0]; // MUST be the last member variable
 
   size_t nodeSize() const override { return sizeof(ConstantNode); }
-  template<typename T> Evaluation<T> templatedApproximate() const;
+  template<typename T> Evaluation<T> templatedApproximate() const { return Complex<T>::Builder(templatedApproximateToComplex<T>()); }
+  template<typename T> std::complex<T> templatedApproximateToComplex() const;
   bool isConstantCodePoint(CodePoint c) const;
 };
 
@@ -21,6 +21,11 @@ public:
   virtual SymbolAbstractType expressionTypeForIdentifier(const char * identifier, int length) = 0;
   virtual const Expression expressionForSymbolAbstract(const SymbolAbstract & symbol, bool clone, float unknownSymbolValue = NAN) = 0;
   virtual void setExpressionForSymbolAbstract(const Expression & expression, const SymbolAbstract & symbol) = 0;
+  /* If the symbol is bound to a number, approximationForSymbol sets it in
+   * value and returns true, which spares approximations the expansion of the
+   * symbol into an expression. A context which overrides the expressions of
+   * symbols must override this method accordingly. */
+  virtual bool approximationForSymbol(const char * name, double * value) { return false; }
 };
 
 }
@@ -22,7 +22,8 @@ public:
   // Properties
   Type type() const override { return Type::Cosine; }
 
-  template<typename T> static Complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit = Preferences::AngleUnit::Radian);
+  template<typename T> static std::complex<T> computeScalar(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit);
+  template<typename T> static Complex<T> computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit = Preferences::AngleUnit::Radian) { return Complex<T>::Builder(computeScalar(c, complexFormat, angleUnit)); }
 
 private:
   // Layout
@@ -44,6 +45,12 @@ private:
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return ApproximationHelper::Map<double>(this, approximationContext, computeOnComplex<double>);
   }
+  bool approximateToComplex(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override {
+    return ApproximationHelper::MapToComplex<float>(this, approximationContext, computeScalar<float>, result);
+  }
+  bool approximateToComplex(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override {
+    return ApproximationHelper::MapToComplex<double>(this, approximationContext, computeScalar<double>, result);
+  }
 };
 
 class Cosine final : public Expression {
@@ -52,6 +52,14 @@ public:
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return Complex<double>::Builder(templatedApproximate<double>());
   }
+  bool approximateToComplex(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override {
+    *result = ComplexNode<float>::Normalize(templatedApproximate<float>());
+    return true;
+  }
+  bool approximateToComplex(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override {
+    *result = ComplexNode<double>::Normalize(templatedApproximate<double>());
+    return true;
+  }
 
   // Comparison
   /* Warning: Decimal(mantissa: 1000, exponent: 3) and Decimal(mantissa: 1, exponent: 3)
@@ -236,6 +236,23 @@ public:
   virtual bool isNumber() const { return false; }
   virtual bool isRandom() const { return false; }
   virtual bool isParameteredExpression() const { return false; }
+
+  /* Summary flags
+   * summaryFlags is the union of the flags of all the nodes of the subtree. It
+   * is memoized in the nodes and reset when their children change, so that
+   * type queries on an unchanged tree only traverse it once. */
+  enum SummaryFlag : uint16_t {
+    SummaryIsComputed = 1 << 0,
+    ContainsMatrix = 1 << 1,
+    ContainsUnit = 1 << 2,
+    ContainsRandom = 1 << 3,
+    ContainsSymbol = 1 << 4,
+    ContainsFunction = 1 << 5,
+    ContainsApproximate = 1 << 6,
+    ContainsInfinity = 1 << 7
+  };
+  static_assert(ContainsInfinity < 1 << k_numberOfSummaryFlagBits, "The summary flags do not fit in the node header");
+  uint16_t summaryFlags() const;
   /* childAtIndexNeedsUserParentheses checks if parentheses are required by mathematical rules:
    * +(2,-1) --> 2+(-1)
    * *(+(2,1),3) --> (2+1)*3
@@ -282,6 +299,12 @@ public:
   constexpr static int k_maxNumberOfSteps = 10000;
   virtual Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const = 0;
   virtual Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const = 0;
+  /* approximateToComplex approximates a scalar subtree without building
+   * evaluations in the pool. It returns false if the subtree is not scalar, in
+   * which case approximate should be used instead. Nodes which do not override
+   * it are approximated with approximate. */
+  virtual bool approximateToComplex(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const;
+  virtual bool approximateToComplex(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const;
 
   /* Simplification */
   /*!*/ virtual void deepReduceChildren(ReductionContext reductionContext);
@@ -28,7 +28,17 @@ public:
   Expression removeUnit(Expression * unit) override;
 
   // Approximation
-  template<typename T> static Complex<T> compute(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) { return Complex<T>::Builder(c*d); }
+  template<typename T> static std::complex<T> computeScalar(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) {
+    /* Finite reals are multiplied as reals, which gives the same result
+     * without the overhead of the complex multiplication. Infinite and
+     * undefined operands need the complex multiplication to get the same
+     * undefined parts. */
+    if (c.imag() == (T)0.0 && d.imag() == (T)0.0 && std::isfinite(c.real()) && std::isfinite(d.real())) {
+      return std::complex<T>(c.real()*d.real());
+    }
+    return c*d;
+  }
+  template<typename T> static Complex<T> compute(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) { return Complex<T>::Builder(computeScalar(c, d, complexFormat)); }
   template<typename T> static MatrixComplex<T> computeOnComplexAndMatrix(const std::complex<T> c, const MatrixComplex<T> m, Preferences::ComplexFormat complexFormat) {
     return ApproximationHelper::ElementWiseOnMatrixComplexAndComplex(m, c, complexFormat, compute<T>);
   }
@@ -62,6 +72,12 @@ private:
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return ApproximationHelper::MapReduce<double>(this, approximationContext, compute<double>, computeOnComplexAndMatrix<double>, computeOnMatrixAndComplex<double>, computeOnMatrices<double>);
   }
+  bool approximateToComplex(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override {
+    return ApproximationHelper::MapReduceToComplex<float>(this, approximationContext, computeScalar<float>, result);
+  }
+  bool approximateToComplex(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override {
+    return ApproximationHelper::MapReduceToComplex<double>(this, approximationContext, computeScalar<double>, result);
+  }
 };
 
 class Multiplication : public NAryExpression {
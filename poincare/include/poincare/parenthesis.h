@@ -35,6 +35,8 @@ public:
   // Approximation
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<double>(approximationContext); }
+  bool approximateToComplex(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override { return childAtIndex(0)->approximateToComplex(p, approximationContext, result); }
+  bool approximateToComplex(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override { return childAtIndex(0)->approximateToComplex(p, approximationContext, result); }
 private:
  template<typename T> Evaluation<T> templatedApproximate(ApproximationContext approximationContext) const;
 };
@@ -36,6 +36,8 @@ private:
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<double>(approximationContext); }
   template<typename T> Evaluation<T> templatedApproximate(ApproximationContext approximationContext) const;
+  // 1001! overflows a double, let alone a float
+  constexpr static int k_maxNumberOfFactors = 1000;
 };
 
 class PermuteCoefficient final : public Expression {
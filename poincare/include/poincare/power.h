@@ -40,6 +40,7 @@ public:
 
   template<typename T> static Complex<T> computeNotPrincipalRealRootOfRationalPow(const std::complex<T> c, T p, T q);
   template<typename T> static Complex<T> compute(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat);
+  template<typename T> static std::complex<T> computeScalar(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat);
 
 private:
   constexpr static int k_maxApproximatePowerMatrix = 1000;
@@ -70,7 +71,16 @@ private:
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override {
     return templatedApproximate<double>(approximationContext);
   }
+  bool approximateToComplex(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override {
+    return templatedApproximateToComplex<float>(approximationContext, result);
+  }
+  bool approximateToComplex(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override {
+    return templatedApproximateToComplex<double>(approximationContext, result);
+  }
  template<typename T> Evaluation<T> templatedApproximate(ApproximationContext approximationContext) const;
+ template<typename T> bool templatedApproximateToComplex(ApproximationContext approximationContext, std::complex<T> * result) const;
+ template<typename T> static std::complex<T> computeScalarNotPrincipalRealRootOfRationalPow(const std::complex<T> c, T p, T q);
+ template<typename T> bool rationalIndexApproximation(T * p, T * q) const;
 };
 
 class Power final : public Expression {
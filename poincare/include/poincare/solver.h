@@ -4,6 +4,7 @@
 #include <poincare/context.h>
 #include <poincare/coordinate_2D.h>
 #include <poincare/preferences.h>
+#include <complex>
 
 namespace Poincare {
 
@@ -17,6 +18,16 @@ public:
   static double BrentRoot(double ax, double bx, double precision, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1 = nullptr, const void * context2 = nullptr, const void * context3 = nullptr);
   static Coordinate2D<double> IncreasingFunctionRoot(double ax, double bx, double resultPrecision, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1 = nullptr, const void * context2 = nullptr, const void * context3 = nullptr, double * resultEvaluation = nullptr);
 
+  /* Polynomial roots
+   * PolynomialRoots approximates at once all the complex roots of the
+   * polynomial sum(coefficients[i]*x^i) for i in [0, degree], with the
+   * Aberth-Ehrlich simultaneous iteration. Multiple roots are returned once,
+   * and real roots have a null imaginary part.
+   * Roots are sorted by real part, then by imaginary part. It returns the
+   * number of distinct roots, or -1 if the iteration did not converge. */
+  constexpr static int k_maxPolynomialRootsDegree = 10;
+  static int PolynomialRoots(const double * coefficients, int degree, std::complex<double> * roots);
+
   // Proba
 
   // Cumulative distributive inverse for function defined on N (positive integers)
@@ -29,6 +40,15 @@ private:
   constexpr static int k_maxNumberOfOperations = 1000000;
   constexpr static double k_maxProbability = 0.9999995;
   constexpr static double k_sqrtEps = 1.4901161193847656E-8; // sqrt(DBL_EPSILON)
+  constexpr static int k_maxNumberOfAberthIterations = 500;
+  constexpr static int k_maxNumberOfPolishingSteps = 8;
+  /* Roots closer than k_clusterDistance (relatively to their modulus) are
+   * gathered and merged into a multiple root if the polynomial and its
+   * derivatives vanish, up to k_multipleRootTolerance, at their centroid. */
+  constexpr static double k_clusterDistance = 0.1;
+  constexpr static double k_multipleRootTolerance = 1E-11;
+  // Real and imaginary parts smaller than k_negligiblePartRatio*|root| are 0
+  constexpr static double k_negligiblePartRatio = 1E-11;
   constexpr static double k_goldenRatio = 0.381966011250105151795413165634361882279690820194237137864; // (3-sqrt(5))/2
 };
 
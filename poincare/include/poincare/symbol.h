@@ -42,6 +42,8 @@ public:
   /* Approximation */
   Evaluation<float> approximate(SinglePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<float>(approximationContext); }
   Evaluation<double> approximate(DoublePrecision p, ApproximationContext approximationContext) const override { return templatedApproximate<double>(approximationContext); }
+  bool approximateToComplex(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const override { return templatedApproximateToComplex<float>(approximationContext, result); }
+  bool approximateToComplex(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const override { return templatedApproximateToComplex<double>(approximationContext, result); }
 
   bool isUnknown() const;
 private:
@@ -49,6 +51,7 @@ private:
 
   size_t nodeSize() const override { return sizeof(SymbolNode); }
   template<typename T> Evaluation<T> templatedApproximate(ApproximationContext approximationContext) const;
+  template<typename T> bool templatedApproximateToComplex(ApproximationContext approximationContext, std::complex<T> * result) const;
 };
 
 class Symbol final : public SymbolAbstract {
@@ -16,7 +16,10 @@
  *  - an identifier
  *  - a parent identifier
  *  - a reference counter
- */
+ * Identifiers are smaller than TreePool::MaxNumberOfNodes, so they only need
+ * k_identifierBits. The remaining bits of the identifier and the parent
+ * identifier hold the memoized summary flags, which therefore do not grow the
+ * nodes. */
 
 /* CAUTION: To make node operations faster, the pool needs all adresses and
  * sizes of TreeNodes to be a multiple of 4. */
@@ -47,7 +50,7 @@ public:
 
   // Attributes
   void setParentIdentifier(uint16_t parentID) { m_parentIdentifier = parentID; }
-  void deleteParentIdentifier() { m_parentIdentifier = NoNodeIdentifier; }
+  void deleteParentIdentifier() { m_parentIdentifier = static_cast<int16_t>(NoNodeIdentifier); }
   virtual size_t size() const = 0;
   uint16_t identifier() const { return m_identifier; }
   int retainCount() const { return m_referenceCounter; }
@@ -56,6 +59,20 @@ public:
   // Ghost
   virtual bool isGhost() const { return false; }
 
+  /* Summary flags
+   * A node can memoize a bottom-up summary of its subtree (see
+   * ExpressionNode::summaryFlags). A null value means the summary is unknown.
+   * Invalidating a node also invalidates its ancestors, and stops at the first
+   * one that is already invalid: ancestors of an invalid node never hold a
+   * summary. */
+  uint16_t memoizedSummaryFlags() const { return m_summaryFlagsLow | m_summaryFlagsHigh << k_summaryFlagsHalfBits; }
+  void memoizeSummaryFlags(uint16_t flags) const {
+    assert(flags < 1 << k_numberOfSummaryFlagBits);
+    m_summaryFlagsLow = flags;
+    m_summaryFlagsHigh = flags >> k_summaryFlagsHalfBits;
+  }
+  void invalidateSummaryFlags();
+
   // Node operations
   void setReferenceCounter(int refCount) { m_referenceCounter = refCount; }
   void retain() { m_referenceCounter++; }
@@ -173,11 +190,18 @@ public:
 #endif
 
   static bool IsValidIdentifier(uint16_t id) { return id < NoNodeIdentifier; }
+  /* Identifiers are stored as signed values, so that NoNodeIdentifier and
+   * OverflowIdentifier are sign-extended back when they are read. */
+  constexpr static int k_identifierBits = 12;
+  constexpr static int k_maxNumberOfIdentifiers = 1 << (k_identifierBits - 1);
+  constexpr static int k_numberOfSummaryFlagBits = 2*(16 - k_identifierBits);
 
 protected:
   TreeNode() :
-    m_identifier(NoNodeIdentifier),
-    m_parentIdentifier(NoNodeIdentifier),
+    m_identifier(static_cast<int16_t>(NoNodeIdentifier)),
+    m_summaryFlagsLow(0),
+    m_parentIdentifier(static_cast<int16_t>(NoNodeIdentifier)),
+    m_summaryFlagsHigh(0),
     m_referenceCounter(0)
   {}
 
@@ -186,8 +210,11 @@ private:
     changeParentIdentifierInChildren(m_identifier);
   }
   void changeParentIdentifierInChildren(uint16_t id) const;
-  uint16_t m_identifier;
-  uint16_t m_parentIdentifier;
+  constexpr static int k_summaryFlagsHalfBits = k_numberOfSummaryFlagBits/2;
+  int16_t m_identifier : k_identifierBits;
+  mutable uint16_t m_summaryFlagsLow : k_summaryFlagsHalfBits;
+  int16_t m_parentIdentifier : k_identifierBits;
+  mutable uint16_t m_summaryFlagsHigh : k_summaryFlagsHalfBits;
   int8_t m_referenceCounter;
 };
 
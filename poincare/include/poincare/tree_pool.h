@@ -41,7 +41,9 @@ public:
   void removeChildrenAndDestroy(TreeNode * nodeToDestroy, int nodeNumberOfChildren);
 
   TreeNode * deepCopy(TreeNode * node);
-  TreeNode * copyTreeFromAddress(const void * address, size_t size);
+  /* Trees copied from outside the pool may hold stale bytes where the summary
+   * flags are memoized, so those are only kept when copying a pool tree. */
+  TreeNode * copyTreeFromAddress(const void * address, size_t size, bool keepSummaryFlags = false);
 
 #if POINCARE_TREE_LOG
   void flatLog(std::ostream & stream);
@@ -53,6 +55,7 @@ public:
 private:
   constexpr static int BufferSize = 16384;
   constexpr static int MaxNumberOfNodes = BufferSize/sizeof(TreeNode);
+  static_assert(MaxNumberOfNodes <= TreeNode::k_maxNumberOfIdentifiers, "Node identifiers do not fit in TreeNode::k_identifierBits");
   constexpr static int k_maxNodeOffset = BufferSize/ByteAlignment;
 
   static TreePool * SharedStaticPool;
@@ -3,15 +3,23 @@
 
 #include <poincare/context_with_parent.h>
 #include <poincare/float.h>
+#include <string.h>
 
 namespace Poincare {
 
+/* A VariableContext binds a variable to a value. When the value is set as an
+ * approximation, it is kept as a number and updated in place, so that a
+ * context can be reused to approximate an expression at many values of the
+ * variable without building anything in the pool. */
+
 class VariableContext : public ContextWithParent {
 public:
   VariableContext(const char * name, Context * parentContext) :
     ContextWithParent(parentContext),
     m_name(name),
-    m_value()
+    m_value(),
+    m_approximation(NAN),
+    m_valueType(ValueType::Expression)
   {}
   template<typename T>
   void setApproximationForVariable(T value);
@@ -19,10 +27,20 @@ public:
   // Context
   void setExpressionForSymbolAbstract(const Expression & expression, const SymbolAbstract & symbol) override;
   const Expression expressionForSymbolAbstract(const SymbolAbstract & symbol, bool clone, float unknownSymbolValue = NAN) override;
+  bool approximationForSymbol(const char * name, double * value) override;
 
 private:
+  enum class ValueType : uint8_t {
+    Expression,
+    FloatApproximation,
+    DoubleApproximation
+  };
+  bool isVariable(const char * name) const { return m_name != nullptr && strcmp(name, m_name) == 0; }
   const char * m_name;
   Expression m_value;
+  // Floats are stored exactly as doubles
+  double m_approximation;
+  ValueType m_valueType;
 };
 
 }
@@ -123,6 +123,43 @@ template<typename T> Evaluation<T> ApproximationHelper::MapReduce(const Expressi
   return result;
 }
 
+template<typename T> bool ApproximationHelper::MapToComplex(const ExpressionNode * expression, ExpressionNode::ApproximationContext approximationContext, ScalarCompute<T> compute, std::complex<T> * result) {
+  assert(expression->numberOfChildren() == 1);
+  std::complex<T> input;
+  if (!expression->childAtIndex(0)->approximateToComplex(T(), approximationContext, &input)) {
+    return false;
+  }
+  *result = ComplexNode<T>::Normalize(compute(input, approximationContext.complexFormat(), approximationContext.angleUnit()));
+  return true;
+}
+
+template<typename T> bool ApproximationHelper::MapReduceToComplex(const ExpressionNode * expression, ExpressionNode::ApproximationContext approximationContext, ScalarReduction<T> computeOnComplexes, std::complex<T> * result) {
+  assert(expression->numberOfChildren() > 0);
+  if (!expression->childAtIndex(0)->approximateToComplex(T(), approximationContext, result)) {
+    return false;
+  }
+  for (int i = 1; i < expression->numberOfChildren(); i++) {
+    std::complex<T> nextOperand;
+    if (!expression->childAtIndex(i)->approximateToComplex(T(), approximationContext, &nextOperand)) {
+      return false;
+    }
+    *result = ComplexNode<T>::Normalize(computeOnComplexes(*result, nextOperand, approximationContext.complexFormat()));
+    // As in MapReduce, the remaining operands are not approximated
+    if (std::isnan(result->real()) && std::isnan(result->imag())) {
+      return true;
+    }
+  }
+  return true;
+}
+
+template<typename T> T ApproximationHelper::ApproximateToScalar(const ExpressionNode * expression, ExpressionNode::ApproximationContext approximationContext) {
+  std::complex<T> c;
+  if (!expression->approximateToComplex(T(), approximationContext, &c) || c.imag() != (T)0.0) {
+    return NAN;
+  }
+  return c.real();
+}
+
 template<typename T> MatrixComplex<T> ApproximationHelper::ElementWiseOnMatrixComplexAndComplex(const MatrixComplex<T> m, const std::complex<T> c, Poincare::Preferences::ComplexFormat complexFormat, ComplexAndComplexReduction<T> computeOnComplexes) {
   MatrixComplex<T> matrix = MatrixComplex<T>::Builder();
   for (int i = 0; i < m.numberOfChildren(); i++) {
@@ -153,6 +190,12 @@ template Poincare::Evaluation<float> Poincare::ApproximationHelper::Map(const Po
 template Poincare::Evaluation<double> Poincare::ApproximationHelper::Map(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext, Poincare::ApproximationHelper::ComplexCompute<double> compute);
 template Poincare::Evaluation<float> Poincare::ApproximationHelper::MapReduce(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext, Poincare::ApproximationHelper::ComplexAndComplexReduction<float> computeOnComplexes, Poincare::ApproximationHelper::ComplexAndMatrixReduction<float> computeOnComplexAndMatrix, Poincare::ApproximationHelper::MatrixAndComplexReduction<float> computeOnMatrixAndComplex, Poincare::ApproximationHelper::MatrixAndMatrixReduction<float> computeOnMatrices);
 template Poincare::Evaluation<double> Poincare::ApproximationHelper::MapReduce(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext, Poincare::ApproximationHelper::ComplexAndComplexReduction<double> computeOnComplexes, Poincare::ApproximationHelper::ComplexAndMatrixReduction<double> computeOnComplexAndMatrix, Poincare::ApproximationHelper::MatrixAndComplexReduction<double> computeOnMatrixAndComplex, Poincare::ApproximationHelper::MatrixAndMatrixReduction<double> computeOnMatrices);
+template bool Poincare::ApproximationHelper::MapToComplex(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext, Poincare::ApproximationHelper::ScalarCompute<float> compute, std::complex<float> * result);
+template bool Poincare::ApproximationHelper::MapToComplex(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext, Poincare::ApproximationHelper::ScalarCompute<double> compute, std::complex<double> * result);
+template bool Poincare::ApproximationHelper::MapReduceToComplex(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext, Poincare::ApproximationHelper::ScalarReduction<float> computeOnComplexes, std::complex<float> * result);
+template bool Poincare::ApproximationHelper::MapReduceToComplex(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext, Poincare::ApproximationHelper::ScalarReduction<double> computeOnComplexes, std::complex<double> * result);
+template float Poincare::ApproximationHelper::ApproximateToScalar<float>(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext);
+template double Poincare::ApproximationHelper::ApproximateToScalar<double>(const Poincare::ExpressionNode * expression, ExpressionNode::ApproximationContext);
 template Poincare::MatrixComplex<float> Poincare::ApproximationHelper::ElementWiseOnMatrixComplexAndComplex<float>(const Poincare::MatrixComplex<float>, const std::complex<float>, Poincare::Preferences::ComplexFormat, Poincare::Complex<float> (*)(std::complex<float>, std::complex<float>, Poincare::Preferences::ComplexFormat));
 template Poincare::MatrixComplex<double> Poincare::ApproximationHelper::ElementWiseOnMatrixComplexAndComplex<double>(const Poincare::MatrixComplex<double>, std::complex<double> const, Poincare::Preferences::ComplexFormat, Poincare::Complex<double> (*)(std::complex<double>, std::complex<double>, Poincare::Preferences::ComplexFormat));
 template Poincare::MatrixComplex<float> Poincare::ApproximationHelper::ElementWiseOnComplexMatrices<float>(const Poincare::MatrixComplex<float>, const Poincare::MatrixComplex<float>, Poincare::Preferences::ComplexFormat, Poincare::Complex<float> (*)(std::complex<float>, std::complex<float>, Poincare::Preferences::ComplexFormat));
@@ -7,6 +7,7 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <cmath>
+#include <limits>
 #include <utility>
 
 namespace Poincare {
@@ -38,25 +39,58 @@ Complex<T> BinomialCoefficientNode::templatedApproximate(ApproximationContext ap
   return Complex<T>::Builder(compute(k, n));
 }
 
+template<typename T>
+static T signOfGamma(T x) {
+  // Γ is positive on ]0,+∞[ and alternates its sign between negative integers
+  return x > (T)0.0 || std::fmod(std::floor(-x), (T)2.0) != (T)0.0 ? (T)1.0 : (T)-1.0;
+}
+
 template<typename T>
 T BinomialCoefficientNode::compute(T k, T n) {
-  if (std::isnan(n) || std::isnan(k) || k != std::round(k) || k < 0) {
+  if (std::isnan(n) || std::isnan(k) || std::isinf(k) || k != std::round(k) || k < 0) {
     return NAN;
   }
   // Generalized definition allows any n value
-  bool generalized = (n != std::round(n) || n < k);
-  // Take advantage of symmetry
-  k = (!generalized && k > (n - k)) ? n - k : k;
+  bool nIsInteger = n == std::round(n);
+  if (nIsInteger && n < k) {
+    if (n >= 0) {
+      return 0;
+    }
+    // binomial(n,k) = (-1)^k×binomial(k-n-1,k) when n is a negative integer
+    return (std::fmod(k, (T)2.0) == (T)0.0 ? (T)1.0 : (T)-1.0) * compute(k, k - n - (T)1.0);
+  }
+  /* Beyond a few factors, the result is computed with log-gamma: it would
+   * otherwise take k steps. */
+  if (nIsInteger) {
+    // Take advantage of symmetry
+    k = k > (n - k) ? n - k : k;
+    /* Then n ≥ 2k and the result is at least binomial(2k,k), which overflows
+     * beyond a thousand factors. Log-gamma cannot tell it when n is so large
+     * that n-k rounds to n. */
+    if (k > k_maxNumberOfFactors) {
+      return INFINITY;
+    }
+    T logResult = std::lgamma(n + (T)1.0) - std::lgamma(k + (T)1.0) - std::lgamma(n - k + (T)1.0);
+    if (logResult > std::log(std::numeric_limits<T>::max())) {
+      return INFINITY;
+    }
+  } else if (k > k_maxNumberOfFactors) {
+    T n1 = n + (T)1.0;
+    T nk1 = n - k + (T)1.0;
+    return signOfGamma(n1) * signOfGamma(nk1) * std::exp(std::lgamma(n1) - std::lgamma(k + (T)1.0) - std::lgamma(nk1));
+  }
 
+  // k is now at most k_maxNumberOfFactors
   T result = 1;
-  for (int i = 0; i < k; i++) {
+  int numberOfFactors = static_cast<int>(k);
+  for (int i = 0; i < numberOfFactors; i++) {
     result *= (n - (T)i) / (k - (T)i);
     if (std::isinf(result) || std::isnan(result)) {
       return result;
     }
   }
   // If not generalized, the output must be round
-  return generalized ? result : std::round(result);
+  return nIsInteger ? std::round(result) : result;
 }
 
 
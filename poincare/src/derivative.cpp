@@ -1,4 +1,5 @@
 #include <poincare/derivative.h>
+#include <poincare/approximation_helper.h>
 #include <poincare/ieee754.h>
 #include <poincare/layout_helper.h>
 #include <poincare/multiplication.h>
@@ -43,6 +44,10 @@ template<typename T>
 Evaluation<T> DerivativeNode::templatedApproximate(ApproximationContext approximationContext) const {
   Evaluation<T> evaluationArgumentInput = childAtIndex(2)->approximate(T(), approximationContext);
   T evaluationArgument = evaluationArgumentInput.toScalar();
+  /* The function is approximated at each abscissa in the same context, where
+   * the value of the variable is updated in place. */
+  VariableContext variableContext = VariableContext(static_cast<SymbolNode *>(childAtIndex(1))->name(), approximationContext.context());
+  approximationContext.setContext(&variableContext);
   T functionValue = approximateWithArgument(evaluationArgument, approximationContext);
   // No complex/matrix version of Derivative
   if (std::isnan(evaluationArgument) || std::isnan(functionValue)) {
@@ -85,11 +90,10 @@ Evaluation<T> DerivativeNode::templatedApproximate(ApproximationContext approxim
 template<typename T>
 T DerivativeNode::approximateWithArgument(T x, ApproximationContext approximationContext) const {
   assert(childAtIndex(1)->type() == Type::Symbol);
-  VariableContext variableContext = VariableContext(static_cast<SymbolNode *>(childAtIndex(1))->name(), approximationContext.context());
-  variableContext.setApproximationForVariable<T>(x);
+  // The context is the one of the variable, see templatedApproximate
+  static_cast<VariableContext *>(approximationContext.context())->setApproximationForVariable<T>(x);
   // Here we cannot use Expression::approximateWithValueForSymbol which would reset the sApproximationEncounteredComplex flag
-  approximationContext.setContext(&variableContext);
-  return childAtIndex(0)->approximate(T(), approximationContext).toScalar();
+  return ApproximationHelper::ApproximateToScalar<T>(childAtIndex(0), approximationContext);
 }
 
 template<typename T>
@@ -55,11 +55,11 @@ Expression DivisionNode::shallowReduce(ReductionContext reductionContext) {
   return Division(this).shallowReduce(reductionContext);
 }
 
-template<typename T> Complex<T> DivisionNode::compute(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) {
+template<typename T> std::complex<T> DivisionNode::computeScalar(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) {
   if (d.real() == (T)0.0 && d.imag() == (T)0.0) {
-    return Complex<T>::Undefined();
+    return std::complex<T>(NAN, NAN);
   }
-  return Complex<T>::Builder(c/d);
+  return c/d;
 }
 
 template<typename T> MatrixComplex<T> DivisionNode::computeOnComplexAndMatrix(const std::complex<T> c, const MatrixComplex<T> n, Preferences::ComplexFormat complexFormat) {
@@ -83,7 +83,43 @@ bool Expression::isRationalOne() const {
   return type() == ExpressionNode::Type::Rational && convert<const Rational>().isOne();
 }
 
+static uint16_t SummaryFlagForTest(Expression::ExpressionTest test) {
+  if (test == Expression::IsMatrix) {
+    return ExpressionNode::ContainsMatrix;
+  }
+  if (test == Expression::IsRandom) {
+    return ExpressionNode::ContainsRandom;
+  }
+  if (test == Expression::IsApproximate) {
+    return ExpressionNode::ContainsApproximate;
+  }
+  if (test == Expression::IsInfinity) {
+    return ExpressionNode::ContainsInfinity;
+  }
+  if (test == Expression::IsUnit) {
+    return ExpressionNode::ContainsUnit;
+  }
+  return 0;
+}
+
 bool Expression::recursivelyMatches(ExpressionTest test, Context * context, ExpressionNode::SymbolicComputation replaceSymbols) const {
+  uint16_t testFlag = SummaryFlagForTest(test);
+  if (testFlag != 0) {
+    /* The summary flags answer for the whole tree, unless a symbol or a
+     * function might be replaced with a definition that matches the test. The
+     * traversal does not look into the arguments of functions either. */
+    uint16_t flags = node()->summaryFlags();
+    bool definitionsMayMatch = replaceSymbols != ExpressionNode::SymbolicComputation::DoNotReplaceAnySymbol
+      && ((flags & ExpressionNode::ContainsFunction)
+          || (replaceSymbols != ExpressionNode::SymbolicComputation::ReplaceDefinedFunctionsWithDefinitions
+            && (flags & ExpressionNode::ContainsSymbol)));
+    if (!(flags & testFlag) && !definitionsMayMatch) {
+      return false;
+    }
+    if ((flags & testFlag) && !(flags & ExpressionNode::ContainsFunction)) {
+      return true;
+    }
+  }
   if (test(*this, context)) {
     return true;
   }
@@ -132,6 +168,10 @@ bool Expression::deepIsMatrix(Context * context) const {
   /* We could do something virtual instead of implementing a disjunction on
    * types but in a first try, it was easier to group all code regarding
    * isMatrix at the same place. */
+  if (!(node()->summaryFlags() & ExpressionNode::ContainsMatrix)) {
+    // No node of the tree can be a matrix
+    return false;
+  }
   if (IsMatrix(*this, context)) {
     return true;
   }
@@ -191,6 +231,10 @@ bool Expression::IsInfinity(const Expression e, Context * context) {
   return e.type() == ExpressionNode::Type::Infinity;
 }
 
+bool Expression::IsUnit(const Expression e, Context * context) {
+  return e.type() == ExpressionNode::Type::Unit;
+}
+
 bool containsVariables(const Expression e, char * variables, int maxVariableSize) {
   if (e.type() == ExpressionNode::Type::Symbol) {
     int index = 0;
@@ -500,7 +544,7 @@ int Expression::getPolynomialReducedCoefficients(const char * symbolName, Expres
 /* Units */
 
 bool Expression::hasUnit() const {
-  return recursivelyMatches([](const Expression e, Context * context) { return e.type() == ExpressionNode::Type::Unit; }, nullptr, ExpressionNode::SymbolicComputation::DoNotReplaceAnySymbol);
+  return recursivelyMatches(IsUnit, nullptr, ExpressionNode::SymbolicComputation::DoNotReplaceAnySymbol);
 }
 
 /* Complex */
@@ -870,7 +914,19 @@ Expression Expression::approximate(Context * context, Preferences::ComplexFormat
 
 template<typename U>
 U Expression::approximateToScalar(Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, bool withinReduce) const {
-  return approximateToEvaluation<U>(context, complexFormat, angleUnit, withinReduce).toScalar();
+  /* Scalar expressions are approximated without building evaluations in the
+   * pool, which matters when plotting or filling tables. The flags are handled
+   * as in approximateToEvaluation. */
+  sApproximationEncounteredComplex = false;
+  sSimplificationHasBeenInterrupted = false;
+  std::complex<U> c;
+  if (!node()->approximateToComplex(U(), ExpressionNode::ApproximationContext(context, complexFormat, angleUnit, withinReduce), &c)) {
+    return approximateToEvaluation<U>(context, complexFormat, angleUnit, withinReduce).toScalar();
+  }
+  if ((complexFormat == Preferences::ComplexFormat::Real && sApproximationEncounteredComplex) || c.imag() != (U)0.0) {
+    return NAN;
+  }
+  return c.real();
 }
 
 template<typename U>
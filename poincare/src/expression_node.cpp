@@ -2,6 +2,7 @@
 #include <poincare/expression.h>
 #include <poincare/addition.h>
 #include <poincare/arc_tangent.h>
+#include <poincare/complex.h>
 #include <poincare/complex_cartesian.h>
 #include <poincare/division.h>
 #include <poincare/power.h>
@@ -99,6 +100,24 @@ int ExpressionNode::simplificationOrderSameType(const ExpressionNode * e, bool a
   return 0;
 }
 
+template<typename T>
+static bool approximateToComplexWithEvaluation(const ExpressionNode * e, ExpressionNode::ApproximationContext approximationContext, std::complex<T> * result) {
+  Evaluation<T> evaluation = e->approximate(T(), approximationContext);
+  if (evaluation.type() != EvaluationNode<T>::Type::Complex) {
+    return false;
+  }
+  *result = static_cast<Complex<T> &>(evaluation).stdComplex();
+  return true;
+}
+
+bool ExpressionNode::approximateToComplex(SinglePrecision p, ApproximationContext approximationContext, std::complex<float> * result) const {
+  return approximateToComplexWithEvaluation<float>(this, approximationContext, result);
+}
+
+bool ExpressionNode::approximateToComplex(DoublePrecision p, ApproximationContext approximationContext, std::complex<double> * result) const {
+  return approximateToComplexWithEvaluation<double>(this, approximationContext, result);
+}
+
 void ExpressionNode::deepReduceChildren(ExpressionNode::ReductionContext reductionContext) {
   Expression(this).defaultDeepReduceChildren(reductionContext);
 }
@@ -132,6 +151,40 @@ bool ExpressionNode::isOfType(Type * types, int length) const {
   return false;
 }
 
+uint16_t ExpressionNode::summaryFlags() const {
+  uint16_t flags = memoizedSummaryFlags();
+  if (flags != 0) {
+    return flags;
+  }
+  Expression e(this);
+  flags = SummaryIsComputed;
+  if (Expression::IsMatrix(e, nullptr)) {
+    flags |= ContainsMatrix;
+  }
+  if (Expression::IsApproximate(e, nullptr)) {
+    flags |= ContainsApproximate;
+  }
+  if (Expression::IsInfinity(e, nullptr)) {
+    flags |= ContainsInfinity;
+  }
+  if (isRandom()) {
+    flags |= ContainsRandom;
+  }
+  Type t = type();
+  if (t == Type::Unit) {
+    flags |= ContainsUnit;
+  } else if (t == Type::Symbol) {
+    flags |= ContainsSymbol;
+  } else if (t == Type::Function) {
+    flags |= ContainsFunction;
+  }
+  for (ExpressionNode * c : children()) {
+    flags |= c->summaryFlags();
+  }
+  memoizeSummaryFlags(flags);
+  return flags;
+}
+
 Expression ExpressionNode::removeUnit(Expression * unit) {
   return Expression(this);
 }
@@ -50,8 +50,8 @@ Multiplication Factor::createMultiplicationOfIntegerPrimeDecomposition(Integer i
   assert(!i.isZero());
   assert(!i.isNegative());
   Multiplication m = Multiplication::Builder();
-  Integer factors[Arithmetic::k_maxNumberOfPrimeFactors];
-  Integer coefficients[Arithmetic::k_maxNumberOfPrimeFactors];
+  uint32_t factors[Arithmetic::k_maxNumberOfPrimeFactors];
+  uint8_t coefficients[Arithmetic::k_maxNumberOfPrimeFactors];
   int numberOfPrimeFactors = Arithmetic::PrimeFactorization(i, factors, coefficients, Arithmetic::k_maxNumberOfPrimeFactors);
   if (numberOfPrimeFactors == 0) {
     m.addChildAtIndexInPlace(Rational::Builder(i), 0, 0);
@@ -62,8 +62,8 @@ Multiplication Factor::createMultiplicationOfIntegerPrimeDecomposition(Integer i
     return m;
   }
   for (int index = 0; index < numberOfPrimeFactors; index++) {
-    Expression factor = Rational::Builder(factors[index]);
-    if (!coefficients[index].isOne()) {
+    Expression factor = Rational::Builder(static_cast<native_int_t>(factors[index]));
+    if (coefficients[index] != 1) {
       factor = Power::Builder(factor, Rational::Builder(coefficients[index]));
     }
     m.addChildAtIndexInPlace(factor, m.numberOfChildren(), m.numberOfChildren());
@@ -53,15 +53,17 @@ Expression FactorialNode::shallowReduce(ReductionContext reductionContext) {
 template<typename T>
 Complex<T> FactorialNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   T n = c.real();
-  if (c.imag() != 0 || std::isnan(n) || n != (int)n || n < 0) {
+  if (c.imag() != 0 || std::isnan(n) || std::isinf(n) || n != std::round(n) || n < 0) {
     return Complex<T>::RealUndefined();
   }
+  // 171! and 35! overflow doubles and floats: the product is not worth computing
+  constexpr int maxOperand = sizeof(T) == sizeof(double) ? 170 : 34;
+  if (n > maxOperand) {
+    return Complex<T>::Builder(INFINITY);
+  }
   T result = 1;
   for (int i = 1; i <= (int)n; i++) {
     result *= (T)i;
-    if (std::isinf(result)) {
-      return Complex<T>::Builder(result);
-    }
   }
   return Complex<T>::Builder(std::round(result));
 }
@@ -1,4 +1,5 @@
 #include <poincare/init.h>
+#include <poincare/arithmetic.h>
 #include <poincare/expression.h>
 #include <poincare/integer.h>
 #include <poincare/tree_pool.h>
@@ -14,6 +15,8 @@ void Init() {
 void Tidy() {
   // Clean Expression (reset the SymbolReplacementsLock)
   Expression::Tidy();
+  // Empty the memoized factorizations
+  Arithmetic::ResetPrimeFactorizationCache();
 }
 
 }
@@ -1,4 +1,5 @@
 #include <poincare/integral.h>
+#include <poincare/approximation_helper.h>
 #include <poincare/complex.h>
 #include <poincare/integral_layout.h>
 #include <poincare/serialization_helper.h>
@@ -52,6 +53,10 @@ Evaluation<T> IntegralNode::templatedApproximate(ApproximationContext approximat
   if (std::isnan(a) || std::isnan(b)) {
     return Complex<T>::RealUndefined();
   }
+  /* The integrand is approximated at each abscissa in the same context, where
+   * the value of the variable is updated in place. */
+  VariableContext variableContext = VariableContext(static_cast<SymbolNode *>(childAtIndex(1))->name(), approximationContext.context());
+  approximationContext.setContext(&variableContext);
 #ifdef LAGRANGE_METHOD
   T result = lagrangeGaussQuadrature<T>(a, b, approximationContext);
 #else
@@ -64,10 +69,9 @@ template<typename T>
 T IntegralNode::functionValueAtAbscissa(T x, ApproximationContext approximationContext) const {
   // Here we cannot use Expression::approximateWithValueForSymbol which would reset the sApproximationEncounteredComplex flag
   assert(childAtIndex(1)->type() == Type::Symbol);
-  VariableContext variableContext = VariableContext(static_cast<SymbolNode *>(childAtIndex(1))->name(), approximationContext.context());
-  variableContext.setApproximationForVariable<T>(x);
-  approximationContext.setContext(&variableContext);
-  return childAtIndex(0)->approximate(T(), approximationContext).toScalar();
+  // The context is the one of the integration variable, see templatedApproximate
+  static_cast<VariableContext *>(approximationContext.context())->setApproximationForVariable<T>(x);
+  return ApproximationHelper::ApproximateToScalar<T>(childAtIndex(0), approximationContext);
 }
 
 #ifdef LAGRANGE_METHOD
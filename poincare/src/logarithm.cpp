@@ -363,8 +363,8 @@ Expression Logarithm::unaryFunctionDifferential(ExpressionNode::ReductionContext
 Expression Logarithm::splitLogarithmInteger(Integer i, bool isDenominator, ExpressionNode::ReductionContext reductionContext) {
   assert(!i.isZero());
   assert(!i.isNegative());
-  Integer factors[Arithmetic::k_maxNumberOfPrimeFactors];
-  Integer coefficients[Arithmetic::k_maxNumberOfPrimeFactors];
+  uint32_t factors[Arithmetic::k_maxNumberOfPrimeFactors];
+  uint8_t coefficients[Arithmetic::k_maxNumberOfPrimeFactors];
   int numberOfPrimeFactors = Arithmetic::PrimeFactorization(i, factors, coefficients, Arithmetic::k_maxNumberOfPrimeFactors);
   if (numberOfPrimeFactors == 0) {
     return Rational::Builder(0);
@@ -382,12 +382,10 @@ Expression Logarithm::splitLogarithmInteger(Integer i, bool isDenominator, Expre
   }
   Addition a = Addition::Builder();
   for (int index = 0; index < numberOfPrimeFactors; index++) {
-    if (isDenominator) {
-      coefficients[index].setNegative(true);
-    }
+    Integer coefficient(isDenominator ? -coefficients[index] : coefficients[index]);
     Logarithm e = clone().convert<Logarithm>();
-    e.replaceChildAtIndexInPlace(0, Rational::Builder(factors[index]));
-    Multiplication m = Multiplication::Builder(Rational::Builder(coefficients[index]), e);
+    e.replaceChildAtIndexInPlace(0, Rational::Builder(static_cast<native_int_t>(factors[index])));
+    Multiplication m = Multiplication::Builder(Rational::Builder(coefficient), e);
     e.simpleShallowReduce(reductionContext);
     a.addChildAtIndexInPlace(m, a.numberOfChildren(), a.numberOfChildren());
     m.shallowReduce(reductionContext);
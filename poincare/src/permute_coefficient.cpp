@@ -8,6 +8,7 @@ extern "C" {
 #include <assert.h>
 }
 #include <cmath>
+#include <limits>
 
 namespace Poincare {
 
@@ -33,16 +34,23 @@ Evaluation<T> PermuteCoefficientNode::templatedApproximate(ApproximationContext
   Evaluation<T> kInput = childAtIndex(1)->approximate(T(), approximationContext);
   T n = nInput.toScalar();
   T k = kInput.toScalar();
-  if (std::isnan(n) || std::isnan(k) || n != std::round(n) || k != std::round(k) || n < 0.0f || k < 0.0f) {
+  if (std::isnan(n) || std::isnan(k) || std::isinf(n) || std::isinf(k) || n != std::round(n) || k != std::round(k) || n < 0.0f || k < 0.0f) {
     return Complex<T>::RealUndefined();
   }
   if (k > n) {
     return Complex<T>::Builder(0.0);
   }
+  /* The result is at least k!, so it overflows beyond a thousand factors. This
+   * bounds the loop even when n is so large that n-k rounds to n, which
+   * defeats any estimate of log(n!) - log((n-k)!). Below the cap,
+   * log-gamma spares computing the products that are known to overflow. */
+  if (k > k_maxNumberOfFactors || std::lgamma(n + (T)1.0) - std::lgamma(n - k + (T)1.0) > std::log(std::numeric_limits<T>::max())) {
+    return Complex<T>::Builder(INFINITY);
+  }
   T result = 1;
-  for (int i = (int)n-(int)k+1; i <= (int)n; i++) {
-    result *= i;
-    if (std::isinf(result) || std::isnan(result)) {
+  for (int i = static_cast<int>(k) - 1; i >= 0; i--) {
+    result *= n - (T)i;
+    if (std::isinf(result)) {
       return Complex<T>::Builder(result);
     }
   }
@@ -130,6 +130,11 @@ bool PowerNode::childAtIndexNeedsUserParentheses(const Expression & child, int c
 
 template<typename T>
 Complex<T> PowerNode::computeNotPrincipalRealRootOfRationalPow(const std::complex<T> c, T p, T q) {
+  return Complex<T>::Builder(computeScalarNotPrincipalRealRootOfRationalPow(c, p, q));
+}
+
+template<typename T>
+std::complex<T> PowerNode::computeScalarNotPrincipalRealRootOfRationalPow(const std::complex<T> c, T p, T q) {
   // Assert p and q are in fact integers
   assert(std::round(p) == p);
   assert(std::round(q) == q);
@@ -145,17 +150,22 @@ Complex<T> PowerNode::computeNotPrincipalRealRootOfRationalPow(const std::comple
     std::complex<T> absc = c;
     absc.real(std::fabs(absc.real()));
     // compute |c|^(p/q) which is a real
-    Complex<T> absCPowD = PowerNode::compute(absc, std::complex<T>(p/q), Preferences::ComplexFormat::Real);
+    std::complex<T> absCPowD = ComplexNode<T>::Normalize(PowerNode::computeScalar(absc, std::complex<T>(p/q), Preferences::ComplexFormat::Real));
     /* As q is odd, c^(p/q) = (sign(c)^(1/q))^p * |c|^(p/q)
      *                      = sign(c)^p         * |c|^(p/q)
      *                      = -|c|^(p/q) iff c < 0 and p odd */
-    return c.real() < (T)0.0 && std::pow((T)-1.0, p) < (T)0.0 ? Complex<T>::Builder(-absCPowD.stdComplex()) : absCPowD;
+    return c.real() < (T)0.0 && std::pow((T)-1.0, p) < (T)0.0 ? -absCPowD : absCPowD;
   }
-  return Complex<T>::Undefined();
+  return std::complex<T>(NAN, NAN);
 }
 
 template<typename T>
 Complex<T> PowerNode::compute(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) {
+  return Complex<T>::Builder(computeScalar(c, d, complexFormat));
+}
+
+template<typename T>
+std::complex<T> PowerNode::computeScalar(const std::complex<T> c, const std::complex<T> d, Preferences::ComplexFormat complexFormat) {
   std::complex<T> result;
   if (c.imag() == (T)0.0 && d.imag() == (T)0.0 && c.real() != (T)0.0 && (c.real() > (T)0.0 || std::round(d.real()) == d.real())) {
     /* pow: (R+, R) -> R+ (2^1.3 ~ 2.46)
@@ -184,7 +194,7 @@ Complex<T> PowerNode::compute(const std::complex<T> c, const std::complex<T> d,
    * so arg(c^d) = y*ln(r)+xθ.
    * We consider that arg[π] is negligeable if it is negligeable compared to
    * norm(d) = sqrt(x^2+y^2) and ln(r) = ln(norm(c)).*/
-  return Complex<T>::Builder(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(result, c, d, false));
+  return ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(result, c, d, false);
 }
 
 // Layout
@@ -299,42 +309,62 @@ template<typename T> Evaluation<T> PowerNode::templatedApproximate(Approximation
    * root. We return this value in that case to avoid returning "unreal". */
   if (approximationContext.complexFormat() == Preferences::ComplexFormat::Real) {
     Evaluation<T> base = childAtIndex(0)->approximate(T(), approximationContext);
-    if (base.type() != EvaluationNode<T>::Type::Complex) {
-      goto defaultApproximation;
-    }
-    std::complex<T> c = static_cast<Complex<T> &>(base).stdComplex();
-    T p = NAN;
-    T q = NAN;
-    // If the power has been reduced, we look for a rational index
-    if (childAtIndex(1)->type() == ExpressionNode::Type::Rational) {
-      const RationalNode * r = static_cast<const RationalNode *>(childAtIndex(1));
-      p = r->signedNumerator().approximate<T>();
-      q = r->denominator().approximate<T>();
-    }
-    /* If the power has been simplified (reduced + beautified), we look for an
-     * index of the for Division(Rational,Rational). */
-    if (childAtIndex(1)->type() == ExpressionNode::Type::Division && childAtIndex(1)->childAtIndex(0)->type() == ExpressionNode::Type::Rational && childAtIndex(1)->childAtIndex(1)->type() == ExpressionNode::Type::Rational) {
-      const RationalNode * pRat = static_cast<const RationalNode *>(childAtIndex(1)->childAtIndex(0));
-      const RationalNode * qRat = static_cast<const RationalNode *>(childAtIndex(1)->childAtIndex(1));
-      if (!pRat->denominator().isOne() || !qRat->denominator().isOne()) {
-        goto defaultApproximation;
+    T p, q;
+    if (base.type() == EvaluationNode<T>::Type::Complex && rationalIndexApproximation(&p, &q)) {
+      Complex<T> result = computeNotPrincipalRealRootOfRationalPow(static_cast<Complex<T> &>(base).stdComplex(), p, q);
+      if (!result.isUndefined()) {
+        return std::move(result);
       }
-      p = pRat->signedNumerator().approximate<T>();
-      q = qRat->signedNumerator().approximate<T>();
     }
-    /* We don't handle power that haven't been reduced or simplified as the
-     * index can take to many forms and still be equivalent to p/q,
-     * with p, q integers. */
-    if (std::isnan(p) || std::isnan(q)) {
-      goto defaultApproximation;
+  }
+  return ApproximationHelper::MapReduce<T>(this, approximationContext, compute<T>, computeOnComplexAndMatrix<T>, computeOnMatrixAndComplex<T>, computeOnMatrices<T>);
+}
+
+template<typename T> bool PowerNode::templatedApproximateToComplex(ApproximationContext approximationContext, std::complex<T> * result) const {
+  // Same special case as templatedApproximate, with the base approximated once
+  std::complex<T> c;
+  if (!childAtIndex(0)->approximateToComplex(T(), approximationContext, &c)) {
+    return false;
+  }
+  T p, q;
+  if (approximationContext.complexFormat() == Preferences::ComplexFormat::Real && rationalIndexApproximation(&p, &q)) {
+    std::complex<T> root = ComplexNode<T>::Normalize(computeScalarNotPrincipalRealRootOfRationalPow(c, p, q));
+    if (!std::isnan(root.real()) || !std::isnan(root.imag())) {
+      *result = root;
+      return true;
     }
-    Complex<T> result = computeNotPrincipalRealRootOfRationalPow(c, p, q);
-    if (!result.isUndefined()) {
-      return std::move(result);
+  }
+  std::complex<T> d;
+  if (!childAtIndex(1)->approximateToComplex(T(), approximationContext, &d)) {
+    return false;
+  }
+  *result = ComplexNode<T>::Normalize(computeScalar(c, d, approximationContext.complexFormat()));
+  return true;
+}
+
+template<typename T> bool PowerNode::rationalIndexApproximation(T * p, T * q) const {
+  // If the power has been reduced, we look for a rational index
+  if (childAtIndex(1)->type() == ExpressionNode::Type::Rational) {
+    const RationalNode * r = static_cast<const RationalNode *>(childAtIndex(1));
+    *p = r->signedNumerator().approximate<T>();
+    *q = r->denominator().approximate<T>();
+  /* If the power has been simplified (reduced + beautified), we look for an
+   * index of the for Division(Rational,Rational). */
+  } else if (childAtIndex(1)->type() == ExpressionNode::Type::Division && childAtIndex(1)->childAtIndex(0)->type() == ExpressionNode::Type::Rational && childAtIndex(1)->childAtIndex(1)->type() == ExpressionNode::Type::Rational) {
+    const RationalNode * pRat = static_cast<const RationalNode *>(childAtIndex(1)->childAtIndex(0));
+    const RationalNode * qRat = static_cast<const RationalNode *>(childAtIndex(1)->childAtIndex(1));
+    if (!pRat->denominator().isOne() || !qRat->denominator().isOne()) {
+      return false;
     }
+    *p = pRat->signedNumerator().approximate<T>();
+    *q = qRat->signedNumerator().approximate<T>();
+  } else {
+    return false;
   }
-defaultApproximation:
-  return ApproximationHelper::MapReduce<T>(this, approximationContext, compute<T>, computeOnComplexAndMatrix<T>, computeOnMatrixAndComplex<T>, computeOnMatrices<T>);
+  /* We don't handle power that haven't been reduced or simplified as the
+   * index can take to many forms and still be equivalent to p/q,
+   * with p, q integers. */
+  return !std::isnan(*p) && !std::isnan(*q);
 }
 
 // Power
@@ -1138,8 +1168,8 @@ Expression Power::CreateSimplifiedIntegerRationalPower(Integer i, Rational r, bo
   if (i.isOne()) {
     return Rational::Builder(1);
   }
-  Integer factors[Arithmetic::k_maxNumberOfPrimeFactors];
-  Integer coefficients[Arithmetic::k_maxNumberOfPrimeFactors];
+  uint32_t factors[Arithmetic::k_maxNumberOfPrimeFactors];
+  uint8_t coefficients[Arithmetic::k_maxNumberOfPrimeFactors];
   int numberOfPrimeFactors = Arithmetic::PrimeFactorization(i, factors, coefficients, Arithmetic::k_maxNumberOfPrimeFactors);
   if (numberOfPrimeFactors < 0) {
     /* We could not break i in prime factors (it might take either too many
@@ -1151,10 +1181,11 @@ Expression Power::CreateSimplifiedIntegerRationalPower(Integer i, Rational r, bo
   Integer r1(1);
   Integer r2(1);
   for (int index = 0; index < numberOfPrimeFactors; index++) {
-    Integer n = Integer::Multiplication(coefficients[index], r.signedIntegerNumerator());
+    Integer factor(static_cast<native_int_t>(factors[index]));
+    Integer n = Integer::Multiplication(Integer(coefficients[index]), r.signedIntegerNumerator());
     IntegerDivision div = Integer::Division(n, r.integerDenominator());
-    r1 = Integer::Multiplication(r1, Integer::Power(factors[index], div.quotient));
-    r2 = Integer::Multiplication(r2, Integer::Power(factors[index], div.remainder));
+    r1 = Integer::Multiplication(r1, Integer::Power(factor, div.quotient));
+    r2 = Integer::Multiplication(r2, Integer::Power(factor, div.remainder));
   }
   if (r2.isOverflow() || r1.isOverflow()) {
     // we overflow Integer at one point: we abort
@@ -1482,6 +1513,8 @@ bool Power::RationalExponentShouldNotBeReduced(const Rational & b, const Rationa
 
 
 template Complex<float> PowerNode::compute<float>(std::complex<float>, std::complex<float>, Preferences::ComplexFormat);
+template std::complex<float> PowerNode::computeScalar<float>(std::complex<float>, std::complex<float>, Preferences::ComplexFormat);
+template std::complex<double> PowerNode::computeScalar<double>(std::complex<double>, std::complex<double>, Preferences::ComplexFormat);
 template Complex<double> PowerNode::compute<double>(std::complex<double>, std::complex<double>, Preferences::ComplexFormat);
 template Complex<double> PowerNode::computeNotPrincipalRealRootOfRationalPow<double>(std::complex<double>, double, double);
 template Complex<float> PowerNode::computeNotPrincipalRealRootOfRationalPow<float>(std::complex<float>, float, float);
@@ -15,10 +15,10 @@ constexpr Expression::FunctionHelper Sine::s_functionHelper;
 int SineNode::numberOfChildren() const { return Sine::s_functionHelper.numberOfChildren(); }
 
 template<typename T>
-Complex<T> SineNode::computeOnComplex(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
+std::complex<T> SineNode::computeScalar(const std::complex<T> c, Preferences::ComplexFormat, Preferences::AngleUnit angleUnit) {
   std::complex<T> angleInput = Trigonometry::ConvertToRadian(c, angleUnit);
   std::complex<T> res = std::sin(angleInput);
-  return Complex<T>::Builder(ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(res, angleInput));
+  return ApproximationHelper::NeglectRealOrImaginaryPartIfNeglectable(res, angleInput);
 }
 
 Layout SineNode::createLayout(Preferences::PrintFloatMode floatDisplayMode, int numberOfSignificantDigits) const {
@@ -223,6 +223,271 @@ Coordinate2D<double> Solver::IncreasingFunctionRoot(double ax, double bx, double
   return Coordinate2D<double>(currentAbscissa, eval);
 }
 
+/* EvaluatePolynomial computes p(z) and p'(z) with Horner's method, as well as
+ * a bound of the rounding error on p(z). */
+static std::complex<double> EvaluatePolynomial(const std::complex<double> * coefficients, int degree, std::complex<double> z, std::complex<double> * derivative, double * errorBound) {
+  std::complex<double> value = coefficients[degree];
+  std::complex<double> d = 0.0;
+  double absoluteValue = std::abs(value);
+  double modulus = std::abs(z);
+  for (int i = degree - 1; i >= 0; i--) {
+    d = d * z + value;
+    value = value * z + coefficients[i];
+    absoluteValue = absoluteValue * modulus + std::abs(coefficients[i]);
+  }
+  *derivative = d;
+  *errorBound = 4.0 * DBL_EPSILON * (degree + 1) * absoluteValue;
+  return value;
+}
+
+/* TaylorCoefficientsAt computes the coefficients of p(x+c) up to order n-1
+ * by repeated synthetic division, and bounds of their absolute values. */
+static void TaylorCoefficientsAt(const std::complex<double> * coefficients, int degree, std::complex<double> c, int n, std::complex<double> * taylor, double * scales) {
+  std::complex<double> q[Solver::k_maxPolynomialRootsDegree + 1];
+  double absoluteQ[Solver::k_maxPolynomialRootsDegree + 1];
+  double modulus = std::abs(c);
+  for (int i = 0; i <= degree; i++) {
+    q[i] = coefficients[i];
+    absoluteQ[i] = std::abs(coefficients[i]);
+  }
+  for (int k = 0; k < n; k++) {
+    for (int i = degree - 1; i >= k; i--) {
+      q[i] += q[i+1] * c;
+      absoluteQ[i] += absoluteQ[i+1] * modulus;
+    }
+    taylor[k] = q[k];
+    scales[k] = absoluteQ[k];
+  }
+}
+
+static bool RootPrecedes(std::complex<double> a, std::complex<double> b, double tolerance) {
+  // Conjugate roots may have slightly different real parts
+  if (std::fabs(a.real() - b.real()) <= tolerance * (std::abs(a) + std::abs(b))) {
+    return a.imag() < b.imag();
+  }
+  return a.real() < b.real();
+}
+
+int Solver::PolynomialRoots(const double * coefficients, int degree, std::complex<double> * roots) {
+  assert(degree <= k_maxPolynomialRootsDegree);
+  while (degree > 0 && coefficients[degree] == 0.0) {
+    degree--;
+  }
+  int numberOfRoots = 0;
+  /* radii[i] bounds the distance between roots[i] and the exact root it
+   * approximates. */
+  double radii[k_maxPolynomialRootsDegree];
+  // Null roots are factored out
+  int lowestDegree = 0;
+  while (lowestDegree < degree && coefficients[lowestDegree] == 0.0) {
+    lowestDegree++;
+  }
+  if (lowestDegree > 0) {
+    radii[numberOfRoots] = 0.0;
+    roots[numberOfRoots++] = 0.0;
+  }
+  int n = degree - lowestDegree;
+  // Normalized polynomial p of degree n
+  std::complex<double> p[k_maxPolynomialRootsDegree + 1];
+  for (int i = 0; i <= n; i++) {
+    p[i] = coefficients[lowestDegree + i] / coefficients[degree];
+    if (!std::isfinite(p[i].real())) {
+      return -1;
+    }
+  }
+
+  /* Aberth-Ehrlich iteration. The initial guesses are spread on a circle whose
+   * radius has the order of magnitude of the roots, with an offset angle
+   * breaking the symmetry with the real axis. */
+  std::complex<double> z[k_maxPolynomialRootsDegree];
+  bool converged[k_maxPolynomialRootsDegree];
+  double radius = 0.0;
+  for (int i = 0; i < n; i++) {
+    radius = std::max(radius, std::pow(std::abs(p[i]), 1.0/(n - i)));
+  }
+  for (int k = 0; k < n; k++) {
+    z[k] = std::polar(radius, 2.0 * M_PI * k / n + 0.4);
+    converged[k] = false;
+  }
+  int numberOfConvergedRoots = 0;
+  for (int iteration = 0; iteration < k_maxNumberOfAberthIterations && numberOfConvergedRoots < n; iteration++) {
+    for (int k = 0; k < n; k++) {
+      if (converged[k]) {
+        continue;
+      }
+      std::complex<double> derivative;
+      double errorBound;
+      std::complex<double> value = EvaluatePolynomial(p, n, z[k], &derivative, &errorBound);
+      if (std::abs(value) <= errorBound) {
+        // p(z) is only rounding noise: z cannot be refined any further
+        converged[k] = true;
+        numberOfConvergedRoots++;
+        continue;
+      }
+      std::complex<double> repulsion = 0.0;
+      for (int j = 0; j < n; j++) {
+        if (j != k) {
+          repulsion += 1.0 / (z[k] - z[j]);
+        }
+      }
+      std::complex<double> newtonStep = value / derivative;
+      std::complex<double> step = newtonStep / (1.0 - newtonStep * repulsion);
+      if (!std::isfinite(step.real()) || !std::isfinite(step.imag())) {
+        // Null derivative or coinciding guesses: shake the guess
+        step = std::polar(DBL_EPSILON * (1.0 + std::abs(z[k])) * 1E3, 1.0 + k);
+      }
+      z[k] -= step;
+    }
+  }
+  if (numberOfConvergedRoots < n) {
+    return -1;
+  }
+
+  /* Gather close roots, merge them if they form a multiple root and polish
+   * simple roots with a few Newton steps. */
+  bool gathered[k_maxPolynomialRootsDegree];
+  for (int k = 0; k < n; k++) {
+    gathered[k] = false;
+  }
+  for (int k = 0; k < n; k++) {
+    if (gathered[k]) {
+      continue;
+    }
+    int cluster[k_maxPolynomialRootsDegree];
+    int clusterSize = 0;
+    cluster[clusterSize++] = k;
+    gathered[k] = true;
+    for (int c = 0; c < clusterSize; c++) {
+      std::complex<double> member = z[cluster[c]];
+      for (int j = k + 1; j < n; j++) {
+        if (!gathered[j] && std::abs(z[j] - member) <= k_clusterDistance * (1.0 + std::abs(member))) {
+          cluster[clusterSize++] = j;
+          gathered[j] = true;
+        }
+      }
+    }
+    std::complex<double> centroid = 0.0;
+    for (int c = 0; c < clusterSize; c++) {
+      centroid += z[cluster[c]];
+    }
+    centroid /= static_cast<double>(clusterSize);
+    // The spread of the iterates bounds the error on a multiple root
+    double spread = 0.0;
+    for (int c = 0; c < clusterSize; c++) {
+      spread = std::max(spread, std::abs(z[cluster[c]] - centroid));
+    }
+    bool isMultipleRoot = clusterSize > 1;
+    if (isMultipleRoot) {
+      /* The iterates of a multiple root are scattered around it. As a root of
+       * multiplicity m of p is a simple root of its (m-1)-th derivative, the
+       * centroid is refined with Newton steps on this derivative. */
+      std::complex<double> taylor[k_maxPolynomialRootsDegree + 1];
+      double scales[k_maxPolynomialRootsDegree + 1];
+      for (int i = 0; i < k_maxNumberOfPolishingSteps; i++) {
+        TaylorCoefficientsAt(p, n, centroid, clusterSize + 1, taylor, scales);
+        std::complex<double> step = taylor[clusterSize - 1] / (static_cast<double>(clusterSize) * taylor[clusterSize]);
+        if (!std::isfinite(step.real()) || !std::isfinite(step.imag())) {
+          break;
+        }
+        centroid -= step;
+        if (std::abs(step) <= DBL_EPSILON * std::abs(centroid)) {
+          break;
+        }
+      }
+      // p and its first m-1 derivatives must vanish at the centroid
+      TaylorCoefficientsAt(p, n, centroid, clusterSize, taylor, scales);
+      for (int i = 0; i < clusterSize; i++) {
+        if (std::abs(taylor[i]) > k_multipleRootTolerance * scales[i]) {
+          isMultipleRoot = false;
+          break;
+        }
+      }
+    }
+    int numberOfCandidates = isMultipleRoot ? 1 : clusterSize;
+    for (int c = 0; c < numberOfCandidates; c++) {
+      std::complex<double> root = isMultipleRoot ? centroid : z[cluster[c]];
+      std::complex<double> derivative;
+      double errorBound;
+      std::complex<double> value = EvaluatePolynomial(p, n, root, &derivative, &errorBound);
+      for (int i = 0; i < k_maxNumberOfPolishingSteps && !isMultipleRoot && std::abs(value) > errorBound; i++) {
+        std::complex<double> polished = root - value / derivative;
+        std::complex<double> polishedDerivative;
+        double polishedErrorBound;
+        std::complex<double> polishedValue = EvaluatePolynomial(p, n, polished, &polishedDerivative, &polishedErrorBound);
+        if (!(std::abs(polishedValue) < std::abs(value))) {
+          break;
+        }
+        root = polished;
+        value = polishedValue;
+        derivative = polishedDerivative;
+        errorBound = polishedErrorBound;
+      }
+      double modulus = std::abs(root);
+      if (std::fabs(root.real()) < k_negligiblePartRatio * modulus) {
+        root.real(0.0);
+      }
+      if (std::fabs(root.imag()) < k_negligiblePartRatio * modulus) {
+        root.imag(0.0);
+      }
+      /* A disk of radius n*|p(z)|/|p'(z)| around z contains a root of p. Its
+       * rounding error is taken into account as well. */
+      radii[numberOfRoots] = isMultipleRoot ? spread : n * (std::abs(value) + errorBound) / std::abs(derivative);
+      roots[numberOfRoots++] = root;
+    }
+  }
+
+  /* The coefficients are real, so non-real roots come in conjugate pairs. Ill
+   * conditioned real roots, such as those of Wilkinson's polynomial or those
+   * next to a multiple root, may however keep an imaginary residue. A root is
+   * real if it has no conjugate partner, or if it cannot be told apart from
+   * the real axis within its error bound. */
+  bool merged[k_maxPolynomialRootsDegree];
+  for (int i = 0; i < numberOfRoots; i++) {
+    merged[i] = false;
+  }
+  for (int i = 0; i < numberOfRoots; i++) {
+    double imaginaryPart = std::fabs(roots[i].imag());
+    if (merged[i] || imaginaryPart == 0.0) {
+      continue;
+    }
+    int conjugate = -1;
+    for (int j = 0; j < numberOfRoots && conjugate < 0; j++) {
+      // The conjugate is closer to the partner than to the root itself
+      if (j != i && !merged[j] && std::abs(roots[j] - std::conj(roots[i])) < imaginaryPart) {
+        conjugate = j;
+      }
+    }
+    if (conjugate >= 0 && imaginaryPart > std::max(radii[i], radii[conjugate])) {
+      continue;
+    }
+    roots[i].imag(0.0);
+    if (conjugate >= 0) {
+      // Both iterates of the pair approximate the same real root
+      roots[i].real((roots[i].real() + roots[conjugate].real()) / 2.0);
+      merged[conjugate] = true;
+    }
+  }
+  int numberOfDistinctRoots = 0;
+  for (int i = 0; i < numberOfRoots; i++) {
+    if (!merged[i]) {
+      roots[numberOfDistinctRoots++] = roots[i];
+    }
+  }
+  numberOfRoots = numberOfDistinctRoots;
+
+  // Insertion sort
+  for (int i = 1; i < numberOfRoots; i++) {
+    std::complex<double> root = roots[i];
+    int j = i;
+    while (j > 0 && RootPrecedes(root, roots[j-1], k_negligiblePartRatio)) {
+      roots[j] = roots[j-1];
+      j--;
+    }
+    roots[j] = root;
+  }
+  return numberOfRoots;
+}
+
 template<typename T>
 T Solver::CumulativeDistributiveInverseForNDefinedFunction(T * probability, ValueAtAbscissa evaluation, Context * context, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit, const void * context1, const void * context2, const void * context3) {
   T precision = sizeof(T) == sizeof(double) ? DBL_EPSILON : FLT_EPSILON;
@@ -33,22 +33,28 @@ Evaluation<T> SumAndProductNode::templatedApproximate(ApproximationContext appro
     return Complex<T>::Undefined();
   }
   SymbolNode * symbol = static_cast<SymbolNode *>(childAtIndex(1));
+  // The terms are approximated in the same context, updated in place
   VariableContext nContext = VariableContext(symbol->name(), approximationContext.context());
+  approximationContext.setContext(&nContext);
+  bool termIsSequence = childAtIndex(0)->type() == ExpressionNode::Type::Sequence;
   Evaluation<T> result = Complex<T>::Builder((T)emptySumAndProductValue());
   for (int i = (int)start; i <= (int)end; i++) {
     if (Expression::ShouldStopProcessing()) {
       return Complex<T>::Undefined();
     }
     nContext.setApproximationForVariable<T>((T)i);
-    Expression child = Expression(childAtIndex(0)).clone();
-    if (child.type() == ExpressionNode::Type::Sequence) {
+    Evaluation<T> term;
+    if (termIsSequence) {
       /* Since we cannot get the expression of a sequence term like we would for
       * a function, we replace its potential abstract rank by the value it should
       * have. We can then evaluate its value */
+      Expression child = Expression(childAtIndex(0)).clone();
       child.childAtIndex(0).replaceSymbolWithExpression(symbol, Float<T>::Builder(i));
+      term = child.node()->approximate(T(), approximationContext);
+    } else {
+      term = childAtIndex(0)->approximate(T(), approximationContext);
     }
-    approximationContext.setContext(&nContext);
-    result = evaluateWithNextTerm(T(), result, child.node()->approximate(T(), approximationContext), approximationContext.complexFormat());
+    result = evaluateWithNextTerm(T(), result, term, approximationContext.complexFormat());
     if (result.isUndefined()) {
       return Complex<T>::Undefined();
     }
@@ -92,6 +92,10 @@ bool SymbolNode::derivate(ReductionContext reductionContext, Expression symbol,
 
 template<typename T>
 Evaluation<T> SymbolNode::templatedApproximate(ApproximationContext approximationContext) const {
+  double value;
+  if (approximationContext.context()->approximationForSymbol(m_name, &value)) {
+    return Complex<T>::Builder(static_cast<T>(value));
+  }
   Symbol s(this);
   Expression e = SymbolAbstract::Expand(s, approximationContext.context(), false);
   if (e.isUninitialized()) {
@@ -100,6 +104,22 @@ Evaluation<T> SymbolNode::templatedApproximate(ApproximationContext approximatio
   return e.node()->approximate(T(), approximationContext);
 }
 
+template<typename T>
+bool SymbolNode::templatedApproximateToComplex(ApproximationContext approximationContext, std::complex<T> * result) const {
+  double value;
+  if (approximationContext.context()->approximationForSymbol(m_name, &value)) {
+    *result = ComplexNode<T>::Normalize(static_cast<T>(value));
+    return true;
+  }
+  Symbol s(this);
+  Expression e = SymbolAbstract::Expand(s, approximationContext.context(), false);
+  if (e.isUninitialized()) {
+    *result = std::complex<T>(NAN, NAN);
+    return true;
+  }
+  return e.node()->approximateToComplex(T(), approximationContext, result);
+}
+
 bool SymbolNode::isUnknown() const {
   bool result = UTF8Helper::CodePointIs(m_name, UCodePointUnknown);
   if (result) {
@@ -76,6 +76,7 @@ void TreeHandle::replaceChildInPlace(TreeHandle oldChild, TreeHandle newChild) {
   TreePool::sharedPool()->move(TreePool::sharedPool()->last(), oldChild.node(), oldChild.numberOfChildren());
   oldChild.node()->release(oldChild.numberOfChildren());
   oldChild.deleteParentIdentifier();
+  node()->invalidateSummaryFlags();
 }
 
 void TreeHandle::replaceChildAtIndexInPlace(int oldChildIndex, TreeHandle newChild) {
@@ -104,10 +105,12 @@ void TreeHandle::mergeChildrenAtIndexInPlace(TreeHandle t, int i) {
   }
   node()->incrementNumberOfChildren(numberOfNewChildren);
   t.node()->eraseNumberOfChildren();
+  t.node()->invalidateSummaryFlags();
   for (int j = 0; j < numberOfNewChildren; j++) {
     assert(i+j < numberOfChildren());
     childAtIndex(i+j).setParentIdentifier(identifier());
   }
+  node()->invalidateSummaryFlags();
   // If t is a child, remove it
   if (node()->hasChild(t.node())) {
     removeChildInPlace(t, 0);
@@ -156,6 +159,7 @@ void TreeHandle::addChildAtIndexInPlace(TreeHandle t, int index, int currentNumb
   t.node()->retain();
   node()->incrementNumberOfChildren();
   t.setParentIdentifier(identifier());
+  node()->invalidateSummaryFlags();
 
   node()->didAddChildAtIndex(currentNumberOfChildren+1);
 }
@@ -175,12 +179,14 @@ void TreeHandle::removeChildInPlace(TreeHandle t, int childNumberOfChildren) {
   t.node()->release(childNumberOfChildren);
   t.deleteParentIdentifier();
   node()->decrementNumberOfChildren();
+  node()->invalidateSummaryFlags();
 }
 
 void TreeHandle::removeChildrenInPlace(int currentNumberOfChildren) {
   assert(!isUninitialized());
   deleteParentIdentifierInChildren();
   TreePool::sharedPool()->removeChildren(node(), currentNumberOfChildren);
+  node()->invalidateSummaryFlags();
 }
 
 /* Private */
@@ -27,6 +27,14 @@ void TreeNode::rename(uint16_t identifier, bool unregisterPreviousIdentifier) {
   updateParentIdentifierInChildren();
 }
 
+void TreeNode::invalidateSummaryFlags() {
+  TreeNode * node = this;
+  while (node != nullptr && node->memoizedSummaryFlags() != 0) {
+    node->memoizeSummaryFlags(0);
+    node = node->parent();
+  }
+}
+
 // Hierarchy
 
 TreeNode * TreeNode::parent() const {
@@ -151,7 +159,7 @@ TreeNode * TreeNode::lastDescendant() const {
 void TreeNode::log(std::ostream & stream, bool recursive) {
   stream << "<";
   logNodeName(stream);
-  stream << " id=\"" << m_identifier << "\"";
+  stream << " id=\"" << identifier() << "\"";
   stream << " refCount=\"" << (int16_t)m_referenceCounter << "\"";
   stream << " size=\"" << size() << "\"";
   logAttributes(stream);
@@ -4,6 +4,7 @@
 #include <poincare/tree_handle.h>
 #include <poincare/test/tree/blob_node.h>
 #include <poincare/test/tree/pair_node.h>
+#include <ion/profiler.h>
 #include <string.h>
 #include <stdint.h>
 #include <poincare_layouts.h>
@@ -13,6 +14,15 @@ namespace Poincare {
 
 TreePool * TreePool::SharedStaticPool = nullptr;
 
+/* The summary flags are packed in the node header, so the most common nodes
+ * are not any bigger than a bare TreeNode. */
+static_assert(sizeof(AdditionNode) == sizeof(TreeNode), "AdditionNode grew beyond the node header");
+static_assert(sizeof(MultiplicationNode) == sizeof(TreeNode), "MultiplicationNode grew beyond the node header");
+static_assert(sizeof(PowerNode) == sizeof(TreeNode), "PowerNode grew beyond the node header");
+static_assert(sizeof(RationalNode) == sizeof(TreeNode), "RationalNode grew beyond the node header");
+static_assert(sizeof(SymbolNode) == sizeof(TreeNode), "SymbolNode grew beyond the node header");
+static_assert(sizeof(IntegerNode) == sizeof(TreeNode), "IntegerNode grew beyond the node header");
+
 void TreePool::freeIdentifier(uint16_t identifier) {
   if (TreeNode::IsValidIdentifier(identifier) && identifier < MaxNumberOfNodes) {
     m_nodeForIdentifierOffset[identifier] = UINT16_MAX;
@@ -45,17 +55,23 @@ void TreePool::removeChildren(TreeNode * node, int nodeNumberOfChildren) {
 
 TreeNode * TreePool::deepCopy(TreeNode * node) {
   size_t size = node->deepSize(-1);
-  return copyTreeFromAddress(static_cast<void *>(node), size);
+  return copyTreeFromAddress(static_cast<void *>(node), size, true);
 }
 
-TreeNode * TreePool::copyTreeFromAddress(const void * address, size_t size) {
+TreeNode * TreePool::copyTreeFromAddress(const void * address, size_t size, bool keepSummaryFlags) {
   void * ptr = alloc(size);
   memcpy(ptr, address, size);
   TreeNode * copy = reinterpret_cast<TreeNode *>(ptr);
   renameNode(copy, false);
+  if (!keepSummaryFlags) {
+    copy->memoizeSummaryFlags(0);
+  }
   for (TreeNode * child : copy->depthFirstChildren()) {
     renameNode(child, false);
     child->retain();
+    if (!keepSummaryFlags) {
+      child->memoizeSummaryFlags(0);
+    }
   }
   return copy;
 }
@@ -119,6 +135,7 @@ void * TreePool::alloc(size_t size) {
   }
   void * result = m_cursor;
   m_cursor += size;
+  Ion::Profiler::reportTreePoolUsage(m_cursor - buffer());
   return result;
 }
 
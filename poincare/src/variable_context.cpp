@@ -8,37 +8,61 @@ namespace Poincare {
 
 template<typename T>
 void VariableContext::setApproximationForVariable(T value) {
-  m_value = Float<T>::Builder(value);
+  m_value = Expression();
+  m_approximation = value;
+  m_valueType = sizeof(T) == sizeof(float) ? ValueType::FloatApproximation : ValueType::DoubleApproximation;
 }
 
 void VariableContext::setExpressionForSymbolAbstract(const Expression & expression, const SymbolAbstract & symbol) {
-  if (m_name != nullptr && strcmp(symbol.name(), m_name) == 0) {
+  if (isVariable(symbol.name())) {
     assert(symbol.type() == ExpressionNode::Type::Symbol);
     if (expression.isUninitialized()) {
       return;
     }
     m_value = expression.clone();
+    m_valueType = ValueType::Expression;
   } else {
     return ContextWithParent::setExpressionForSymbolAbstract(expression, symbol);
   }
 }
 
 const Expression VariableContext::expressionForSymbolAbstract(const SymbolAbstract & symbol, bool clone, float unknownSymbolValue ) {
-  if (m_name != nullptr && strcmp(symbol.name(), m_name) == 0) {
+  if (isVariable(symbol.name())) {
     if (symbol.type() == ExpressionNode::Type::Symbol) {
-      return clone ? m_value.clone() : m_value;
+      switch (m_valueType) {
+        case ValueType::FloatApproximation:
+          return Float<float>::Builder(m_approximation);
+        case ValueType::DoubleApproximation:
+          return Float<double>::Builder(m_approximation);
+        default:
+          assert(m_valueType == ValueType::Expression);
+          return clone ? m_value.clone() : m_value;
+      }
     }
     return Undefined::Builder();
   } else {
     Symbol unknownSymbol = Symbol::Builder(UCodePointUnknown);
-    if (m_name != nullptr && strcmp(m_name, unknownSymbol.name()) == 0) {
+    if (isVariable(unknownSymbol.name())) {
       assert(std::isnan(unknownSymbolValue));
-      unknownSymbolValue = m_value.approximateToScalar<float>(this, Preferences::sharedPreferences()->complexFormat(), Preferences::sharedPreferences()->angleUnit(), true);
+      unknownSymbolValue = m_valueType == ValueType::Expression ?
+        m_value.approximateToScalar<float>(this, Preferences::sharedPreferences()->complexFormat(), Preferences::sharedPreferences()->angleUnit(), true) :
+        static_cast<float>(m_approximation);
     }
     return ContextWithParent::expressionForSymbolAbstract(symbol, clone, unknownSymbolValue);
   }
 }
 
+bool VariableContext::approximationForSymbol(const char * name, double * value) {
+  if (!isVariable(name)) {
+    return ContextWithParent::approximationForSymbol(name, value);
+  }
+  if (m_valueType == ValueType::Expression) {
+    return false;
+  }
+  *value = m_approximation;
+  return true;
+}
+
 template void VariableContext::setApproximationForVariable(float);
 template void VariableContext::setApproximationForVariable(double);
 
@@ -262,6 +262,14 @@ QUIZ_CASE(poincare_approximation_function) {
   assert_expression_approximates_to<double>("binomial(7, 9)", "0");
   assert_expression_approximates_to<float>("binomial(-7, 9)", "-5005");
   assert_expression_approximates_to<double>("binomial(-7, 9)", "-5005");
+  assert_expression_approximates_to<double>("binomial(500, 250)", "1.1674431578828ᴇ149");
+  assert_expression_approximates_to<float>("binomial(500, 250)", Infinity::Name());
+  assert_expression_approximates_to<double>("binomial(2000, 1000)", Infinity::Name());
+  assert_expression_approximates_to<double>("binomial(-2, 5000)", "5001");
+  assert_expression_approximates_to<double>("binomial(0.5, 5000)", "-7.9794440838ᴇ-7", Degree, Metric, Cartesian, 11);
+  assert_expression_approximates_to<float>("binomial(1ᴇ30, 1ᴇ10)", Infinity::Name());
+  assert_expression_approximates_to<double>("binomial(1ᴇ30, 1ᴇ10)", Infinity::Name());
+  assert_expression_approximates_to<double>("binomial(1ᴇ30, 5)", "8.3333333333333ᴇ147");
 
   assert_expression_approximates_to<float>("binompdf(4.4, 9, 0.7)", "0.0735138", Degree, Metric, Cartesian, 6); // FIXME: precision problem
   assert_expression_approximates_to<double>("binompdf(4.4, 9, 0.7)", "0.073513818");
@@ -348,6 +356,11 @@ QUIZ_CASE(poincare_approximation_function) {
 
   assert_expression_approximates_to<float>("permute(10, 4)", "5040");
   assert_expression_approximates_to<double>("permute(10, 4)", "5040");
+  assert_expression_approximates_to<double>("permute(1000, 10)", "9.558606130044ᴇ29");
+  assert_expression_approximates_to<float>("permute(100, 30)", Infinity::Name());
+  assert_expression_approximates_to<double>("permute(1ᴇ9, 1ᴇ6)", Infinity::Name());
+  assert_expression_approximates_to<float>("permute(1ᴇ30, 1ᴇ10)", Infinity::Name());
+  assert_expression_approximates_to<double>("permute(1ᴇ30, 1ᴇ10)", Infinity::Name());
 
   assert_expression_approximates_to<float>("product(n,n, 4, 10)", "604800");
   assert_expression_approximates_to<double>("product(n,n, 4, 10)", "604800");
@@ -458,6 +471,10 @@ QUIZ_CASE(poincare_approximation_function) {
 
   assert_expression_approximates_to<float>("6!", "720");
   assert_expression_approximates_to<double>("6!", "720");
+  assert_expression_approximates_to<float>("35!", Infinity::Name());
+  assert_expression_approximates_to<double>("170!", "7.257415615308ᴇ306");
+  assert_expression_approximates_to<double>("171!", Infinity::Name());
+  assert_expression_approximates_to<double>("1ᴇ15!", Infinity::Name());
 
   assert_expression_approximates_to<float>("√(-1)", "𝐢");
   assert_expression_approximates_to<double>("√(-1)", "𝐢");
@@ -467,6 +484,9 @@ QUIZ_CASE(poincare_approximation_function) {
 
   assert_expression_approximates_to<float>("int(int(x×x,x,0,x),x,0,4)", "21.33333");
   assert_expression_approximates_to<double>("int(int(x×x,x,0,x),x,0,4)", "21.333333333333");
+  assert_expression_approximates_to<double>("int(int(x×t,t,0,x),x,0,1)", "0.125");
+  assert_expression_approximates_to<double>("int(sum(x^k,k,0,2),x,0,1)", "1.8333333333333");
+  assert_expression_approximates_to<double>("sum(diff(x^2,x,k),k,1,3)", "12");
 
   assert_expression_approximates_to<float>("int(1+cos(e),e, 0, 180)", "180");
   assert_expression_approximates_to<double>("int(1+cos(e),e, 0, 180)", "180");
@@ -1014,6 +1034,66 @@ QUIZ_CASE(poincare_approximation_mix) {
   //assert_expression_simplifies_approximates_to<float>("1.0092^(50)×ln(3/2)", "6.4093734888993ᴇ-1"); TODO does not work
 }
 
+template<typename T>
+void assert_scalar_approximation_is_evaluation_approximation(Expression e, Context * context, T x, Preferences::ComplexFormat complexFormat, Preferences::AngleUnit angleUnit) {
+  VariableContext variableContext("x", context);
+  variableContext.setApproximationForVariable<T>(x);
+  T scalar = e.approximateToScalar<T>(&variableContext, complexFormat, angleUnit);
+  // Approximate through evaluations as approximateToScalar used to
+  Expression::SetEncounteredComplex(false);
+  ExpressionNode * node = static_cast<ExpressionNode *>(static_cast<TreeHandle &>(e).node());
+  T evaluation = node->approximate(T(), ExpressionNode::ApproximationContext(&variableContext, complexFormat, angleUnit)).toScalar();
+  if (complexFormat == Real && Expression::EncounteredComplex()) {
+    evaluation = NAN;
+  }
+  quiz_assert((std::isnan(scalar) && std::isnan(evaluation)) || scalar == evaluation);
+}
+
+template<typename T>
+void assert_scalar_approximations_are_evaluation_approximations(const char * expression) {
+  constexpr int numberOfValues = 9;
+  T values[numberOfValues] = {-8.0, -1.0, -0.0, 0.0, 0.5, 3.0, static_cast<T>(1E300), INFINITY, NAN};
+  Preferences::ComplexFormat complexFormats[] = {Real, Cartesian, Polar};
+  Preferences::AngleUnit angleUnits[] = {Radian, Degree};
+  Shared::GlobalContext globalContext;
+  for (Preferences::ComplexFormat complexFormat : complexFormats) {
+    for (Preferences::AngleUnit angleUnit : angleUnits) {
+      Expression parsed = parse_expression(expression, &globalContext, false);
+      Expression simplified = Expression::ParseAndSimplify(expression, &globalContext, complexFormat, angleUnit, Metric);
+      for (int i = 0; i < numberOfValues; i++) {
+        assert_scalar_approximation_is_evaluation_approximation<T>(parsed, &globalContext, values[i], complexFormat, angleUnit);
+        assert_scalar_approximation_is_evaluation_approximation<T>(simplified, &globalContext, values[i], complexFormat, angleUnit);
+      }
+    }
+  }
+}
+
+QUIZ_CASE(poincare_approximation_scalar) {
+  const char * expressions[] = {
+    "sin(x)^2+3x",
+    "x^3-2x^2+x-1",
+    "x^(1/3)",
+    "x^(2/3)",
+    "x^(-3/5)",
+    "x^x",
+    "1/x",
+    "(x-1)/(x+1)",
+    "√(x)+ln(x)",
+    "abs(x)×cos(x)",
+    "tan(x)-x",
+    "ℯ^(x)",
+    "ℯ^(x𝐢)",
+    "𝐢×x+π",
+    "-x×1.5",
+    "2^1000×x",
+    "log(x)+arctan(x)",
+    "[[x,1]]×[[1][x]]",
+  };
+  for (const char * expression : expressions) {
+    assert_scalar_approximations_are_evaluation_approximations<float>(expression);
+    assert_scalar_approximations_are_evaluation_approximations<double>(expression);
+  }
+}
 
 template void assert_expression_approximates_to_scalar(const char * expression, float approximation, Preferences::AngleUnit angleUnit, Preferences::ComplexFormat complexFormat);
 template void assert_expression_approximates_to_scalar(const char * expression, double approximation, Preferences::AngleUnit angleUnit, Preferences::ComplexFormat complexFormat);
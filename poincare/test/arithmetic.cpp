@@ -48,19 +48,15 @@ void assert_lcm_equals_to(Integer a, Integer b, Integer c) {
 }
 
 void assert_prime_factorization_equals_to(Integer a, int * factors, int * coefficients, int length) {
-  Integer outputFactors[100];
-  Integer outputCoefficients[100];
-  Arithmetic::PrimeFactorization(a, outputFactors, outputCoefficients, 10);
+  uint32_t outputFactors[Arithmetic::k_maxNumberOfPrimeFactors];
+  uint8_t outputCoefficients[Arithmetic::k_maxNumberOfPrimeFactors];
+  Arithmetic::PrimeFactorization(a, outputFactors, outputCoefficients, Arithmetic::k_maxNumberOfPrimeFactors);
   constexpr size_t bufferSize = 100;
   char failInformationBuffer[bufferSize];
   fill_buffer_with(failInformationBuffer, bufferSize, "factor(", &a, 1);
   for (int index = 0; index < length; index++) {
-    /* Cheat: instead of comparing to integers, we compare their approximations
-     * (the relation between integers and their approximation is a surjection,
-     * however different integers are really likely to have different
-     * approximations... */
-    quiz_assert_print_if_failure(outputFactors[index].approximate<float>() == Integer(factors[index]).approximate<float>(), failInformationBuffer);
-    quiz_assert_print_if_failure(outputCoefficients[index].approximate<float>() == Integer(coefficients[index]).approximate<float>(), failInformationBuffer);
+    quiz_assert_print_if_failure(outputFactors[index] == static_cast<uint32_t>(factors[index]), failInformationBuffer);
+    quiz_assert_print_if_failure(outputCoefficients[index] == coefficients[index], failInformationBuffer);
   }
 }
 
@@ -94,3 +90,30 @@ QUIZ_CASE(poincare_arithmetic_factorization) {
   int coefficients3[7] = {4,2,2,2,2,2,2};
   assert_prime_factorization_equals_to(Integer("5513219850886344455940081"), factors3, coefficients3, 7);
 }
+
+QUIZ_CASE(poincare_arithmetic_factorization_cache) {
+  Arithmetic::ResetPrimeFactorizationCache();
+  int factors0[5] = {2,3,5,79,1319};
+  int coefficients0[5] = {2,1,1,1,1};
+  // The second factorizations are read from the cache
+  for (int i = 0; i < 2; i++) {
+    assert_prime_factorization_equals_to(Integer(6252060), factors0, coefficients0, 5);
+    assert_prime_factorization_equals_to(Integer(-6252060), factors0, coefficients0, 5);
+  }
+  // Evict the first factorization
+  int factors1[1] = {2};
+  int coefficients1[1] = {1};
+  for (int i = 1; i <= 10; i++) {
+    coefficients1[0] = i;
+    assert_prime_factorization_equals_to(Integer(1 << i), factors1, coefficients1, 1);
+  }
+  assert_prime_factorization_equals_to(Integer(6252060), factors0, coefficients0, 5);
+  // Failures due to too big factors are cached too
+  uint32_t outputFactors[Arithmetic::k_maxNumberOfPrimeFactors];
+  uint8_t outputCoefficients[Arithmetic::k_maxNumberOfPrimeFactors];
+  Integer bigPrime("1000000000000000003");
+  quiz_assert(Arithmetic::PrimeFactorization(bigPrime, outputFactors, outputCoefficients, Arithmetic::k_maxNumberOfPrimeFactors) == -2);
+  quiz_assert(Arithmetic::PrimeFactorization(bigPrime, outputFactors, outputCoefficients, Arithmetic::k_maxNumberOfPrimeFactors) == -2);
+  Arithmetic::ResetPrimeFactorizationCache();
+  assert_prime_factorization_equals_to(Integer(6252060), factors0, coefficients0, 5);
+}
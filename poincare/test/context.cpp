@@ -1,5 +1,6 @@
 #include <apps/shared/global_context.h>
 #include <poincare/serialization_helper.h>
+#include <poincare/variable_context.h>
 #include "helper.h"
 
 using namespace Poincare;
@@ -223,5 +224,35 @@ QUIZ_CASE(poincare_context_user_variable_properties) {
   Ion::Storage::sharedStorage()->recordNamed("g.func").destroy();
 }
 
+QUIZ_CASE(poincare_context_variable_context) {
+  Shared::GlobalContext globalContext;
+  VariableContext xContext("x", &globalContext);
+  VariableContext tContext("t", &xContext);
+  Expression e = parse_expression("x×t+t", &globalContext, false);
+
+  // The values are updated in place, and seen through the nested context
+  tContext.setApproximationForVariable<float>(0.5f);
+  for (int i = 0; i < 3; i++) {
+    xContext.setApproximationForVariable<double>(i);
+    quiz_assert(e.approximateToScalar<double>(&tContext, Cartesian, Radian) == 0.5 * i + 0.5);
+    quiz_assert(e.approximateToScalar<float>(&tContext, Cartesian, Radian) == 0.5f * i + 0.5f);
+  }
+
+  // Approximations can also be fetched as expressions
+  Expression t = tContext.expressionForSymbolAbstract(Symbol::Builder('t'), true);
+  quiz_assert(t.type() == ExpressionNode::Type::Float && t.approximateToScalar<double>(&globalContext, Cartesian, Radian) == 0.5);
+
+  // An expression replaces the approximation
+  xContext.setExpressionForSymbolAbstract(Rational::Builder(7), Symbol::Builder('x'));
+  quiz_assert(e.approximateToScalar<double>(&tContext, Cartesian, Radian) == 4.0);
+  xContext.setApproximationForVariable<double>(1.0);
+  quiz_assert(e.approximateToScalar<double>(&tContext, Cartesian, Radian) == 1.0);
+
+  // The variable of the inner context shadows the outer one
+  VariableContext otherXContext("x", &tContext);
+  otherXContext.setApproximationForVariable<double>(3.0);
+  quiz_assert(e.approximateToScalar<double>(&otherXContext, Cartesian, Radian) == 2.0);
+}
+
 template void assert_parsed_expression_approximates_with_value_for_symbol(Poincare::Expression, const char *, float, float, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit);
 template void assert_parsed_expression_approximates_with_value_for_symbol(Poincare::Expression, const char *, double, double, Poincare::Preferences::ComplexFormat, Poincare::Preferences::AngleUnit);
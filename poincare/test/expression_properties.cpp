@@ -138,6 +138,38 @@ QUIZ_CASE(poincare_properties_is_infinity) {
   Ion::Storage::sharedStorage()->recordNamed("a.exp").destroy();
 }
 
+QUIZ_CASE(poincare_properties_summary_flags) {
+  Shared::GlobalContext context;
+  Expression leaf = Rational::Builder(2);
+  Expression cosine = Cosine::Builder(leaf);
+  Expression e = Addition::Builder(Rational::Builder(1), Multiplication::Builder(Rational::Builder(3), cosine));
+  quiz_assert(!e.deepIsMatrix(&context));
+  quiz_assert(!e.recursivelyMatches(Expression::IsApproximate, &context));
+  // Replacing a deep child updates the flags memoized in its ancestors
+  leaf.replaceWithInPlace(Matrix::Builder());
+  quiz_assert(e.deepIsMatrix(&context));
+  quiz_assert(e.childAtIndex(1).recursivelyMatches(Expression::IsMatrix, &context));
+  cosine.replaceChildAtIndexInPlace(0, Float<double>::Builder(1.5));
+  quiz_assert(!e.deepIsMatrix(&context));
+  quiz_assert(e.recursivelyMatches(Expression::IsApproximate, &context));
+  // Adding and removing children
+  static_cast<Addition &>(e).addChildAtIndexInPlace(Unit::Builder(Unit::k_timeRepresentatives, Unit::Prefix::EmptyPrefix()), 2, 2);
+  quiz_assert(e.hasUnit());
+  static_cast<Addition &>(e).removeChildAtIndexInPlace(2);
+  quiz_assert(!e.hasUnit());
+  // Clones keep the memoized flags, which stay correct
+  Expression c = e.clone();
+  quiz_assert(c.recursivelyMatches(Expression::IsApproximate, &context));
+  quiz_assert(!c.recursivelyMatches(Expression::IsRandom, &context));
+  // Functions and symbols hide the content of their definition
+  Expression f = Multiplication::Builder(Rational::Builder(2), Symbol::Builder('a'));
+  quiz_assert(!f.recursivelyMatches(Expression::IsApproximate, &context));
+  assert_reduce("42.3→a");
+  quiz_assert(f.recursivelyMatches(Expression::IsApproximate, &context));
+  quiz_assert(!f.recursivelyMatches(Expression::IsApproximate, &context, ExpressionNode::SymbolicComputation::DoNotReplaceAnySymbol));
+  Ion::Storage::sharedStorage()->recordNamed("a.exp").destroy();
+}
+
 constexpr Poincare::ExpressionNode::Sign Positive = Poincare::ExpressionNode::Sign::Positive;
 constexpr Poincare::ExpressionNode::Sign Negative = Poincare::ExpressionNode::Sign::Negative;
 constexpr Poincare::ExpressionNode::Sign Unknown = Poincare::ExpressionNode::Sign::Unknown;
@@ -1,4 +1,6 @@
 #include <apps/shared/global_context.h>
+#include <poincare/solver.h>
+#include <cmath>
 #include "helper.h"
 
 using namespace Poincare;
@@ -291,3 +293,45 @@ QUIZ_CASE(poincare_function_intersection) {
     assert_points_of_interest_are(PointOfInterestType::Intersection, numberOfIntersections, intersections, "cos(a)", "0", "a", 500.0, -0.1, -1.0);
   }
 }
+
+void assert_polynomial_roots_are(std::initializer_list<double> coefficients, std::initializer_list<std::complex<double>> expectedRoots) {
+  double c[Solver::k_maxPolynomialRootsDegree + 1];
+  int degree = -1;
+  for (double coefficient : coefficients) {
+    c[++degree] = coefficient;
+  }
+  std::complex<double> roots[Solver::k_maxPolynomialRootsDegree];
+  int numberOfRoots = Solver::PolynomialRoots(c, degree, roots);
+  quiz_assert(numberOfRoots == static_cast<int>(expectedRoots.size()));
+  int i = 0;
+  for (std::complex<double> expectedRoot : expectedRoots) {
+    // Real roots must be exactly real
+    quiz_assert(expectedRoot.imag() != 0.0 || roots[i].imag() == 0.0);
+    quiz_assert(std::abs(roots[i++] - expectedRoot) < 1E-9 * (1.0 + std::abs(expectedRoot)));
+  }
+}
+
+QUIZ_CASE(poincare_solver_polynomial_roots) {
+  // x^2+1
+  assert_polynomial_roots_are({1.0, 0.0, 1.0}, {std::complex<double>(0.0, -1.0), std::complex<double>(0.0, 1.0)});
+  // (x-1)(x-2)(x-3)(x+4)
+  assert_polynomial_roots_are({-24.0, 38.0, -13.0, -2.0, 1.0}, {-4.0, 1.0, 2.0, 3.0});
+  // x^2*(x-1): null roots are factored out
+  assert_polynomial_roots_are({0.0, 0.0, -1.0, 1.0}, {0.0, 1.0});
+  // (x-2)^3*(x+1): multiple roots are merged
+  assert_polynomial_roots_are({8.0, -4.0, -6.0, 5.0, -1.0}, {-1.0, 2.0});
+  // (x-1)(x-1.001)(x-3): close roots are kept apart
+  assert_polynomial_roots_are({-3.003, 7.004, -5.001, 1.0}, {1.0, 1.001, 3.0});
+  // (x-10)^10
+  assert_polynomial_roots_are({1E10, -1E10, 4.5E9, -1.2E9, 2.1E8, -2.52E7, 2.1E6, -1.2E5, 4.5E3, -100.0, 1.0}, {10.0});
+  // (x-1)(x-2)...(x-10): ill conditioned real roots have no imaginary residue
+  assert_polynomial_roots_are({3628800.0, -10628640.0, 12753576.0, -8409500.0, 3416930.0, -902055.0, 157773.0, -18150.0, 1320.0, -55.0, 1.0}, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0});
+  // (x-3)^7*(x+1)(x-2)(x-5): nor do simple roots next to a multiple root
+  assert_polynomial_roots_are({-21870.0, 44469.0, -22599.0, -19764.0, 34776.0, -23058.0, 8862.0, -2132.0, 318.0, -27.0, 1.0}, {-1.0, 2.0, 3.0, 5.0});
+  // x^10-1
+  std::complex<double> unitRoots[10];
+  for (int k = 0; k < 10; k++) {
+    unitRoots[k] = std::polar(1.0, 2.0 * M_PI * k / 10.0);
+  }
+  assert_polynomial_roots_are({-1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0}, {-1.0, unitRoots[6], unitRoots[4], unitRoots[7], unitRoots[3], unitRoots[8], unitRoots[2], unitRoots[9], unitRoots[1], 1.0});
+}
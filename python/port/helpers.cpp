@@ -5,6 +5,28 @@ extern "C" {
 #include "mphalport.h"
 }
 
+int32_t micropython_port_vm_hook_countdown = 1;
+
+static constexpr uint64_t k_vmHookTimeCheckDelay = 10; // ms
+/* Bounding the countdown keeps interruptions responsive if loop iterations
+ * suddenly become much slower than the ones it was calibrated on. */
+static constexpr int32_t k_vmHookMaxCountdown = 1 << 14;
+static int32_t s_vmHookCountdownStart = 1;
+
+void micropython_port_vm_hook_countdown_elapsed() {
+  /* Calibrate the next countdown so that it lasts about
+   * k_vmHookTimeCheckDelay, based on the duration of the previous one. */
+  static uint64_t lastTimeCheck = Ion::Timing::millis();
+  uint64_t currentTime = Ion::Timing::millis();
+  uint64_t elapsed = currentTime - lastTimeCheck;
+  lastTimeCheck = currentTime;
+  int64_t countdown = elapsed == 0 ? 2 * static_cast<int64_t>(s_vmHookCountdownStart) : s_vmHookCountdownStart * k_vmHookTimeCheckDelay / elapsed;
+  countdown = countdown < 1 ? 1 : (countdown > k_vmHookMaxCountdown ? k_vmHookMaxCountdown : countdown);
+  s_vmHookCountdownStart = countdown;
+  micropython_port_vm_hook_countdown = countdown;
+  micropython_port_vm_hook_loop();
+}
+
 bool micropython_port_vm_hook_loop() {
   /* This function is called very frequently by the MicroPython engine. We grab
    * this opportunity to interrupt execution and/or refresh the display on
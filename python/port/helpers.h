@@ -6,14 +6,24 @@ extern "C" {
 #endif
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
+/* Number of VM hooks left before micropython_port_vm_hook_countdown_elapsed
+ * is called. It is calibrated so that the timer is read every few
+ * milliseconds whatever the cost of a loop iteration. */
+extern int32_t micropython_port_vm_hook_countdown;
+void micropython_port_vm_hook_countdown_elapsed();
+
 // These methods return true if they have been interrupted
 bool micropython_port_vm_hook_loop();
 void micropython_port_vm_hook_refresh_print();
 bool micropython_port_interruptible_msleep(int32_t delay);
 bool micropython_port_interrupt_if_needed();
 int micropython_port_random();
+/* Return the value of the name qst once the auto-imported script defining it
+ * has been imported, or NULL if no such script exists. */
+void * micropython_port_load_auto_imported_global(size_t qst);
 
 #ifdef __cplusplus
 }
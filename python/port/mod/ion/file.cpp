@@ -204,9 +204,28 @@ typedef struct _file_obj_t {
     
     bool closed;
     
+    // Pending writes, committed to the record in one go.
+    byte*  write_buffer;
+    size_t write_buffer_position;
+    size_t write_buffer_length;
+    
 } file_obj_t;
 
+/*
+ * Making room at the end of a record slides all the following records, and
+ * giving it back slides them again. Writes are thus gathered in a buffer
+ * allocated in the Python heap and committed on flush, close, seek, read,
+ * truncate, when the buffer is full or when the script ends.
+ *
+ * Only one file holds pending writes at a time. It is referenced by a root
+ * pointer, so that it is not collected before its writes are committed, even
+ * if the script dropped it without closing it.
+ */
+#define FILE_WRITE_BUFFER_SIZE 512
+
 STATIC mp_obj_t __file_read_backend(file_obj_t* file, mp_int_t size, bool with_line_sep);
+STATIC void __file_write_backend(file_obj_t* file, size_t position, const char* buffer, size_t len);
+STATIC void __file_commit_write_buffer(file_obj_t* file);
 
 /*
  * Definition of the file iterator object.
@@ -411,10 +430,19 @@ STATIC mp_obj_t file_make_new(const mp_obj_type_t *type, size_t n_args, size_t n
         }
     }
     
-    if (!Ion::Storage::FullNameCompliant(file_name)) {
+    // The records caching data of the apps are not files
+    if (!Ion::Storage::FullNameCompliant(file_name) || Ion::Storage::FullNameIsCache(file_name)) {
         mp_raise_OSError(22);
     }
     
+    // The record might be re-created below
+    file_flush_pending_write();
+    
+    file->closed = false;
+    file->write_buffer = nullptr;
+    file->write_buffer_position = 0;
+    file->write_buffer_length = 0;
+    
     Ion::Storage::Record::ErrorStatus status;
 
     switch(file->open_mode) {
@@ -564,6 +592,7 @@ STATIC mp_obj_t file_close(mp_obj_t o_in) {
     file_obj_t* file = (file_obj_t*) MP_OBJ_TO_PTR(o_in);
     
     if (!file->closed) {
+        __file_commit_write_buffer(file);
         file->record = Ion::Storage::Record();
         file->closed = true;
     }
@@ -599,6 +628,8 @@ STATIC mp_obj_t file_seek(size_t n_args, const mp_obj_t* args) {
         mp_raise_ValueError("offset must be an int!");
     }
     
+    __file_commit_write_buffer(file);
+    
     int position = mp_obj_get_int(args[1]);
     mp_int_t whence = 0;
     
@@ -662,6 +693,8 @@ STATIC mp_obj_t file_fileno(mp_obj_t o_in) {
 STATIC mp_obj_t file_flush(mp_obj_t o_in) {
     file_obj_t *file = (file_obj_t*) MP_OBJ_TO_PTR(o_in);
     check_closed(file);
+    
+    __file_commit_write_buffer(file);
 
     return mp_const_none;
 }
@@ -722,29 +755,34 @@ STATIC mp_obj_t file_write(mp_obj_t o_in, mp_obj_t o_s) {
     size_t len;
     const char* buffer;
     buffer = mp_obj_str_get_data(o_s, &len);
-
-    size_t previous_size = file->record.value().size;
-    
-    // Claim avaliable space.
-    size_t avaliable_size = Ion::Storage::sharedStorage()->putAvailableSpaceAtEndOfRecord(file->record);
     
-    // Check if there is enough space left
-    if (file->position + len > avaliable_size) {
-        Ion::Storage::sharedStorage()->getAvailableSpaceFromEndOfRecord(file->record, avaliable_size - previous_size);
-        mp_raise_OSError(28);
+    // Only one file can hold pending writes.
+    if (MP_STATE_PORT(file_pending_write) != MP_OBJ_NULL && MP_STATE_PORT(file_pending_write) != o_in) {
+        file_flush_pending_write();
     }
     
-    // Check if seek pos is higher than file end
-    // If yes, fill space between there with 0x00
-    if (file->position > previous_size) {
-        memset((uint8_t*)(file->record.value().buffer) + file->position, 0x00, file->position - previous_size);
+    // Buffered writes must be contiguous.
+    if (file->write_buffer_length > 0 &&
+        (file->position != file->write_buffer_position + file->write_buffer_length
+         || file->write_buffer_length + len > FILE_WRITE_BUFFER_SIZE)) {
+        __file_commit_write_buffer(file);
     }
     
-    // Copy buffer to destination
-    memcpy((uint8_t*)(file->record.value().buffer) + file->position, buffer, len);
+    if (file->write_buffer == nullptr && len <= FILE_WRITE_BUFFER_SIZE) {
+        // If the heap is full, write directly to the record.
+        file->write_buffer = m_new_maybe(byte, FILE_WRITE_BUFFER_SIZE);
+    }
     
-    // Set size again
-    Ion::Storage::sharedStorage()->getAvailableSpaceFromEndOfRecord(file->record, file->record.value().size - std::max(previous_size, file->position + len));
+    if (file->write_buffer == nullptr || len > FILE_WRITE_BUFFER_SIZE) {
+        __file_write_backend(file, file->position, buffer, len);
+    } else {
+        if (file->write_buffer_length == 0) {
+            file->write_buffer_position = file->position;
+            MP_STATE_PORT(file_pending_write) = o_in;
+        }
+        memcpy(file->write_buffer + file->write_buffer_length, buffer, len);
+        file->write_buffer_length += len;
+    }
     
     file->position += len;
     
@@ -765,6 +803,9 @@ STATIC mp_obj_t file_writelines(mp_obj_t o_in, mp_obj_t o_lines) {
  * Simpler read function usef by read and readline.
  */
 STATIC mp_obj_t __file_read_backend(file_obj_t* file, mp_int_t size, bool with_line_sep) {
+    // Read what has been written
+    __file_commit_write_buffer(file);
+    
     size_t file_size = file->record.value().size;
     size_t start = file->position;
     
@@ -972,6 +1013,8 @@ STATIC mp_obj_t file_truncate(size_t n_args, const mp_obj_t* args) {
     
     size_t new_end = (size_t) temp_new_end;
     
+    __file_commit_write_buffer(file);
+    
     size_t previous_size = file->record.value().size;
 
     // Claim avaliable space.
@@ -997,6 +1040,63 @@ STATIC mp_obj_t file_truncate(size_t n_args, const mp_obj_t* args) {
     return mp_const_none;
 }
 
+/*
+ * Copies buffer at position in the record, making room for it.
+ */
+STATIC void __file_write_backend(file_obj_t* file, size_t position, const char* buffer, size_t len) {
+    size_t previous_size = file->record.value().size;
+    
+    // Claim avaliable space.
+    size_t avaliable_size = Ion::Storage::sharedStorage()->putAvailableSpaceAtEndOfRecord(file->record);
+    
+    // Check if there is enough space left
+    if (position + len > avaliable_size) {
+        Ion::Storage::sharedStorage()->getAvailableSpaceFromEndOfRecord(file->record, avaliable_size - previous_size);
+        mp_raise_OSError(28);
+    }
+    
+    // Check if seek pos is higher than file end
+    // If yes, fill space between there with 0x00
+    if (position > previous_size) {
+        memset((uint8_t*)(file->record.value().buffer) + previous_size, 0x00, position - previous_size);
+    }
+    
+    // Copy buffer to destination
+    memcpy((uint8_t*)(file->record.value().buffer) + position, buffer, len);
+    
+    // Set size again
+    Ion::Storage::sharedStorage()->getAvailableSpaceFromEndOfRecord(file->record, file->record.value().size - std::max(previous_size, position + len));
+}
+
+STATIC void __file_commit_write_buffer(file_obj_t* file) {
+    if (file->write_buffer_length == 0) {
+        return;
+    }
+    
+    // The buffer is emptied even if the commit fails, as the data is lost.
+    size_t len = file->write_buffer_length;
+    file->write_buffer_length = 0;
+    if (MP_STATE_PORT(file_pending_write) == MP_OBJ_FROM_PTR(file)) {
+        MP_STATE_PORT(file_pending_write) = MP_OBJ_NULL;
+    }
+    
+    // The record may have moved since the buffered writes.
+    size_t l;
+    const char* file_name = mp_obj_str_get_data(file->name, &l);
+    file->record = Ion::Storage::sharedStorage()->recordNamed(file_name);
+    if (file->record == Ion::Storage::Record()) {
+        mp_raise_OSError(2);
+    }
+    
+    __file_write_backend(file, file->write_buffer_position, (const char*)file->write_buffer, len);
+}
+
+void file_flush_pending_write() {
+    if (MP_STATE_PORT(file_pending_write) != MP_OBJ_NULL) {
+        __file_commit_write_buffer((file_obj_t*) MP_OBJ_TO_PTR(MP_STATE_PORT(file_pending_write)));
+    }
+}
+
 // Open method, with only name. Calls constructor.
 mp_obj_t file_open(mp_obj_t file_name) {
     mp_obj_t args[1];
@@ -5,5 +5,7 @@
 
 mp_obj_t file_open(mp_obj_t file_name);
 mp_obj_t file_open_mode(mp_obj_t file_name, mp_obj_t file_mode);
+// Commits the writes still buffered by a file object
+void file_flush_pending_write();
 
 #endif
@@ -1,5 +1,6 @@
 extern "C" {
 #include "modos.h"
+#include "../ion/file.h"
 #include <string.h>
 #include <py/obj.h>
 #include <py/runtime.h>
@@ -52,9 +53,11 @@ mp_obj_t modos_remove(mp_obj_t o_file_name) {
   const char* file_name;
   file_name = mp_obj_str_get_data(o_file_name, &len);
 
+  file_flush_pending_write();
+
   Ion::Storage::Record record = Ion::Storage::sharedStorage()->recordNamed(file_name);
 
-  if (record == Ion::Storage::Record()) {
+  if (record == Ion::Storage::Record() || Ion::Storage::FullNameIsCache(file_name)) {
     mp_raise_OSError(2);
   }
 
@@ -71,11 +74,17 @@ mp_obj_t modos_rename(mp_obj_t o_old_name, mp_obj_t o_new_name) {
   old_name = mp_obj_str_get_data(o_old_name, &len);
   new_name = mp_obj_str_get_data(o_new_name, &len);
 
+  file_flush_pending_write();
+
   Ion::Storage::Record record = Ion::Storage::sharedStorage()->recordNamed(old_name);
 
-  if (record == Ion::Storage::Record()) {
+  if (record == Ion::Storage::Record() || Ion::Storage::FullNameIsCache(old_name)) {
     mp_raise_OSError(2);
   }
+
+  if (Ion::Storage::FullNameIsCache(new_name)) {
+    mp_raise_OSError(22);
+  }
   
   Ion::Storage::Record::ErrorStatus status = record.setName(new_name);
 
@@ -104,6 +113,9 @@ mp_obj_t modos_listdir(void) {
 
   for(size_t i = 0; i < (size_t)Ion::Storage::sharedStorage()->numberOfRecords(); i++) {
     Ion::Storage::Record record = Ion::Storage::sharedStorage()->recordAtIndex(i);
+    if (Ion::Storage::FullNameIsCache(record.fullName())) {
+      continue;
+    }
     size_t file_name_length = strlen(record.fullName());
     
     mp_obj_t file_name = mp_obj_new_str(record.fullName(), file_name_length);
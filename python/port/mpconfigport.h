@@ -115,7 +115,9 @@
 // (This scheme won't work if we want to mix Thumb and normal ARM code.)
 #define MICROPY_MAKE_POINTER_CALLABLE(p) (p)
 
-#define MICROPY_VM_HOOK_LOOP micropython_port_vm_hook_loop();
+/* The hook is reached on every backwards jump: its common path is a mere
+ * countdown, the costly work happens once it runs out. */
+#define MICROPY_VM_HOOK_LOOP if (--micropython_port_vm_hook_countdown <= 0) { micropython_port_vm_hook_countdown_elapsed(); }
 
 typedef intptr_t mp_int_t; // must be pointer size
 typedef uintptr_t mp_uint_t; // must be pointer size
@@ -129,6 +131,15 @@ typedef long mp_off_t;
 
 #define MP_STATE_PORT MP_STATE_VM
 
+/* file_pending_write is the file object holding writes not yet committed to
+ * the storage. auto_imported_scripts lists the scripts the console imports on
+ * the first lookup of a name they may define. */
+#define MICROPY_PORT_ROOT_POINTERS \
+    mp_obj_t file_pending_write; \
+    mp_obj_t auto_imported_scripts;
+
+#define MICROPY_PORT_LOAD_GLOBAL_FALLBACK(qst) micropython_port_load_auto_imported_global(qst)
+
 extern const struct _mp_obj_module_t modion_module;
 extern const struct _mp_obj_module_t modkandinsky_module;
 extern const struct _mp_obj_module_t modmatplotlib_module;
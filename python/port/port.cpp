@@ -61,6 +61,7 @@ extern "C" {
 #include "mphalport.h"
 #include "mod/turtle/modturtle.h"
 #include "mod/matplotlib/pyplot/modpyplot.h"
+#include "mod/ion/file.h"
 }
 
 #include <escher/palette.h>
@@ -90,6 +91,8 @@ bool MicroPython::ExecutionEnvironment::runCode(const char * str) {
     mp_parse_tree_t pt = mp_parse(lex, MP_PARSE_SINGLE_INPUT);
     mp_obj_t module_fun = mp_compile(&pt, lex->source_name, true);
     mp_call_function_0(module_fun);
+    // Commit the writes of files left open by the script
+    file_flush_pending_write();
     nlr_pop();
   } else { // Uncaught exception
     runSucceeded = false;
@@ -140,6 +143,13 @@ bool MicroPython::ExecutionEnvironment::runCode(const char * str) {
     // Flush the store if an error is encountered to avoid being stuck with a full memory
     modpyplot_flush_used_heap();
     // TODO: do the same for other modules?
+    /* Commit what the script wrote before failing. The writes that do not fit
+     * in the storage are lost, as a script that ran out of space is. */
+    nlr_buf_t flushNlr;
+    if (nlr_push(&flushNlr) == 0) {
+      file_flush_pending_write();
+      nlr_pop();
+    }
   }
 
   // Disable the user interruption
@@ -187,6 +197,8 @@ void MicroPython::init(void * heapStart, void * heapEnd) {
 #endif
   gc_init(heapStart, heapEnd);
   mp_init();
+  MP_STATE_PORT(file_pending_write) = MP_OBJ_NULL;
+  MP_STATE_PORT(auto_imported_scripts) = MP_OBJ_NULL;
 }
 
 void MicroPython::deinit() {
@@ -197,6 +209,101 @@ void MicroPython::registerScriptProvider(ScriptProvider * s) {
   sScriptProvider = s;
 }
 
+void MicroPython::registerAutoImportedScript(const char * moduleName, size_t length) {
+  nlr_buf_t nlr;
+  if (nlr_push(&nlr) == 0) {
+    if (MP_STATE_PORT(auto_imported_scripts) == MP_OBJ_NULL) {
+      MP_STATE_PORT(auto_imported_scripts) = mp_obj_new_list(0, nullptr);
+    }
+    mp_obj_list_append(MP_STATE_PORT(auto_imported_scripts), MP_OBJ_NEW_QSTR(qstr_from_strn(moduleName, length)));
+    nlr_pop();
+  }
+}
+
+static bool isIdentifierChar(char c) {
+  return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || (c & 0x80);
+}
+
+/* A script may define a name if the name appears as a word in its content or
+ * if it imports * from another module. Strings and comments are not told
+ * apart: a false positive only imports the script earlier. */
+static bool scriptMayDefineName(const char * content, const char * name) {
+  size_t nameLength = strlen(name);
+  const char * c = content;
+  while (*c != 0) {
+    if (!isIdentifierChar(*c)) {
+      c++;
+      continue;
+    }
+    const char * word = c;
+    while (isIdentifierChar(*c)) {
+      c++;
+    }
+    size_t wordLength = c - word;
+    if (wordLength == nameLength && strncmp(word, name, nameLength) == 0) {
+      return true;
+    }
+    if (wordLength == 6 && strncmp(word, "import", 6) == 0) {
+      const char * next = c;
+      while (*next == ' ' || *next == '\t') {
+        next++;
+      }
+      if (*next == '*') {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void * micropython_port_load_auto_imported_global(size_t qst) {
+  mp_obj_t scripts = MP_STATE_PORT(auto_imported_scripts);
+  const char * name = qstr_str(qst);
+  /* Only the console namespace gets the auto-imported names, and
+   * "import *" skips the private ones. */
+  if (scripts == MP_OBJ_NULL || sScriptProvider == nullptr || name[0] == '_' || mp_globals_get() != &MP_STATE_VM(dict_main)) {
+    return MP_OBJ_NULL;
+  }
+  size_t numberOfScripts;
+  mp_obj_t * scriptItems;
+  mp_obj_list_get(scripts, &numberOfScripts, &scriptItems);
+  /* Import the pending scripts that may define the name in their registration
+   * order. An entry is the module name while pending and the module once
+   * imported. */
+  for (size_t i = 0; i < numberOfScripts; i++) {
+    if (!mp_obj_is_qstr(scriptItems[i])) {
+      continue;
+    }
+    qstr moduleName = MP_OBJ_QSTR_VALUE(scriptItems[i]);
+    VSTR_FIXED(path, MICROPY_ALLOC_PATH_MAX)
+    vstr_add_str(&path, qstr_str(moduleName));
+    vstr_add_str(&path, ".py");
+    const char * content = sScriptProvider->contentOfScript(vstr_null_terminated_str(&path), false);
+    if (content != nullptr && !scriptMayDefineName(content, name)) {
+      continue;
+    }
+    // The entry is cleared first so that a failing import is not retried
+    scriptItems[i] = mp_const_none;
+    if (content != nullptr) {
+      mp_obj_t module = mp_import_name(moduleName, mp_const_none, MP_OBJ_NEW_SMALL_INT(0));
+      mp_obj_list_get(scripts, &numberOfScripts, &scriptItems);
+      scriptItems[i] = module;
+    }
+  }
+  // As when importing them in order, the last script defining the name wins
+  for (size_t i = numberOfScripts; i-- > 0;) {
+    if (!mp_obj_is_type(scriptItems[i], &mp_type_module)) {
+      continue;
+    }
+    mp_map_elem_t * elem = mp_map_lookup(&mp_obj_module_get_globals(scriptItems[i])->map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+    if (elem != nullptr) {
+      mp_obj_dict_store(MP_OBJ_FROM_PTR(&MP_STATE_VM(dict_main)), MP_OBJ_NEW_QSTR(qst), elem->value);
+      return elem->value;
+    }
+  }
+  return MP_OBJ_NULL;
+}
+
 void MicroPython::collectRootsAtAddress(char * address, int byteLength) {
   /* The given address is not necessarily aligned on sizeof(void *). However,
    * any pointer stored in the range [address, address + byteLength] will be
@@ -39,6 +39,9 @@ public:
 void init(void * heapStart, void * heapEnd);
 void deinit();
 void registerScriptProvider(ScriptProvider * s);
+/* The scripts registered here are imported as "from moduleName import *" the
+ * first time the console looks up a name they may define. */
+void registerAutoImportedScript(const char * moduleName, size_t length);
 void collectRootsAtAddress(char * address, int len);
 
 class Color {
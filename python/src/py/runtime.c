@@ -183,6 +183,13 @@ mp_obj_t mp_load_global(qstr qst) {
         #endif
         elem = mp_map_lookup((mp_map_t*)&mp_module_builtins_globals.map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
         if (elem == NULL) {
+            #ifdef MICROPY_PORT_LOAD_GLOBAL_FALLBACK
+            // give the port a last chance to provide the name
+            mp_obj_t value = MICROPY_PORT_LOAD_GLOBAL_FALLBACK(qst);
+            if (value != MP_OBJ_NULL) {
+                return value;
+            }
+            #endif
             if (MICROPY_ERROR_REPORTING == MICROPY_ERROR_REPORTING_TERSE) {
                 mp_raise_msg(&mp_type_NameError, "name not defined");
             } else {
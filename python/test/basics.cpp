@@ -1,5 +1,6 @@
 #include <quiz.h>
 #include "execution_environment.h"
+#include <string.h>
 
 QUIZ_CASE(python_basics) {
   TestExecutionEnvironment env = init_environement();
@@ -13,3 +14,32 @@ QUIZ_CASE(python_template) {
   assert_script_execution_succeeds(Code::ScriptTemplate::Polynomial()->content());
   assert_script_execution_succeeds(Code::ScriptTemplate::Parabola()->content());
 }
+
+class TestScriptProvider : public MicroPython::ScriptProvider {
+public:
+  const char * contentOfScript(const char * name, bool markAsFetched) override {
+    if (strcmp(name, "first.py") == 0) {
+      return "from math import *\ndef f():\n  return 1\nx = 1\n";
+    }
+    if (strcmp(name, "second.py") == 0) {
+      return "print('imported')\nx = 2\n";
+    }
+    return nullptr;
+  }
+};
+
+QUIZ_CASE(python_auto_import) {
+  TestScriptProvider scriptProvider;
+  TestExecutionEnvironment env = init_environement();
+  MicroPython::registerScriptProvider(&scriptProvider);
+  MicroPython::registerAutoImportedScript("first", 5);
+  MicroPython::registerAutoImportedScript("second", 6);
+  // Only the scripts that may define a name are imported
+  assert_command_execution_succeeds(env, "f()", "1\n");
+  // The last script defining a name wins
+  assert_command_execution_succeeds(env, "x", "imported\n2\n");
+  assert_command_execution_succeeds(env, "sqrt(4)", "2.0\n");
+  assert_command_execution_fails(env, "undefined_name");
+  MicroPython::registerScriptProvider(nullptr);
+  deinit_environment();
+}
@@ -1,5 +1,6 @@
 #include <quiz.h>
 #include "execution_environment.h"
+#include <ion/storage.h>
 
 QUIZ_CASE(python_ion_import) {
   // Test "from ion import *"
@@ -23,3 +24,45 @@ QUIZ_CASE(python_ion_keydown) {
   assert_command_execution_succeeds(env, "keydown(KEY_LEFT)", "False\n");
   deinit_environment();
 }
+
+QUIZ_CASE(python_ion_file_buffered_write) {
+  // Buffered writes are committed when reading, seeking and closing
+  assert_script_execution_succeeds(
+      "f = open('buffered.csv', 'w+')\n"
+      "for i in range(200):\n"
+      "  f.write(str(i) + ',')\n"
+      "f.seek(0)\n"
+      "print(f.read(8))\n"
+      "f.seek(0, 2)\n"
+      "f.writelines(['a', 'b'])\n"
+      "f.close()\n"
+      "print(open('buffered.csv').read()[-8:])\n",
+      "0,1,2,3,\n8,199,ab\n");
+
+  // Writes to a file left open are committed when the command ends
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "g = open('buffered.csv', 'a')");
+  assert_command_execution_succeeds(env, "n = g.write('cd')");
+  assert_command_execution_succeeds(env, "print(open('buffered.csv').read()[-4:])", "abcd\n");
+  // Writing to another file commits the pending writes
+  assert_command_execution_succeeds(env, "h = open('other.csv', 'w')");
+  assert_command_execution_succeeds(env, "n = g.write('e') + h.write('f'); print(open('buffered.csv').read()[-1:])", "e\n");
+  assert_command_execution_succeeds(env, "import os");
+  assert_command_execution_succeeds(env, "os.remove('buffered.csv'); os.remove('other.csv')");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_ion_file_cache_records) {
+  // The records caching data of the apps are not files
+  quiz_assert(Ion::Storage::sharedStorage()->createRecordWithExtension("hidden", Ion::Storage::cacheExtension, "", 0) == Ion::Storage::Record::ErrorStatus::None);
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import os");
+  assert_command_execution_succeeds(env, "print('hidden.cache' in os.listdir())", "False\n");
+  assert_command_execution_fails(env, "open('hidden.cache')");
+  assert_command_execution_fails(env, "open('other.cache', 'w')");
+  assert_command_execution_fails(env, "os.remove('hidden.cache')");
+  assert_command_execution_fails(env, "os.rename('hidden.cache', 'visible.csv')");
+  deinit_environment();
+  quiz_assert(Ion::Storage::sharedStorage()->numberOfRecordsWithExtension(Ion::Storage::cacheExtension) == 1);
+  Ion::Storage::sharedStorage()->destroyRecordsWithExtension(Ion::Storage::cacheExtension);
+}
@@ -9,18 +9,69 @@ void quiz_print(const char * message) {
   Ion::Console::writeLine(message);
 }
 
-static inline void ion_main_inner() {
+static size_t sizeToString(size_t n, char buffer[]) {
+  size_t len = 0;
+  do {
+    buffer[len++] = (n % 10) + '0';
+  } while ((n /= 10) > 0);
+  for (size_t i = 0, j = len - 1; i < j; i++, j--) {
+    char c = buffer[i];
+    buffer[i] = buffer[j];
+    buffer[j] = c;
+  }
+  return len;
+}
+
+static void print_stack_usage(const char * caseName, size_t stackUsage) {
+  constexpr char Stack[] = " stack: ";
+  constexpr char Bytes[] = " bytes";
+  constexpr size_t sizeToStringMaxLength = 20;
+  constexpr size_t MaxNameLength = 63;
+  constexpr size_t MaxLength = MaxNameLength + sizeof(Stack) + sizeToStringMaxLength + sizeof(Bytes);
+  char buffer[MaxLength];
+  char * position = buffer;
+  // strlcpy returns the length of the source, which may have been truncated
+  strlcpy(position, caseName, MaxNameLength + 1);
+  position += strlen(position);
+  position += strlcpy(position, Stack, sizeof(Stack));
+  position += sizeToString(stackUsage, position);
+  strlcpy(position, Bytes, sizeof(Bytes));
+  quiz_print(buffer);
+}
+
+static inline void ion_main_inner(bool printStackUsage) {
   int i = 0;
+  size_t maxStackUsage = 0;
+  int maxStackUsageCase = -1;
   while (quiz_cases[i] != NULL) {
     QuizCase c = quiz_cases[i];
     quiz_print(quiz_case_names[i]);
     int initialPoolSize = Poincare::TreePool::sharedPool()->numberOfNodes();
     quiz_assert(initialPoolSize == 0);
+    Ion::paintStack();
     c();
+    size_t stackUsage = Ion::stackUsage();
+#ifdef NDEBUG
+    /* The stack is only painted down to the size of the device stack, which
+     * the test overflowed if it used it all. Frames are bigger in debug
+     * builds, which are thus not checked. */
+    quiz_assert(stackUsage < Ion::k_stackSize);
+#endif
+    if (printStackUsage) {
+      print_stack_usage(quiz_case_names[i], stackUsage);
+    }
+    if (stackUsage > maxStackUsage) {
+      maxStackUsage = stackUsage;
+      maxStackUsageCase = i;
+    }
     int currentPoolSize = Poincare::TreePool::sharedPool()->numberOfNodes();
     quiz_assert(initialPoolSize == currentPoolSize);
     i++;
   }
+  if (printStackUsage && maxStackUsageCase >= 0) {
+    quiz_print("DEEPEST STACK");
+    print_stack_usage(quiz_case_names[maxStackUsageCase], maxStackUsage);
+  }
   quiz_print("ALL TESTS FINISHED");
 #ifdef PLATFORM_DEVICE
   while (1) {
@@ -42,9 +93,17 @@ void ion_main(int argc, const char * const argv[]) {
   Ion::setStackStart((void *)(&stackTop));
 #endif
 
+  // The stack usage of each case and the deepest one are printed with --stack-usage
+  bool printStackUsage = false;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--stack-usage") == 0) {
+      printStackUsage = true;
+    }
+  }
+
   Poincare::ExceptionCheckpoint ecp;
   if (ExceptionRun(ecp)) {
-    ion_main_inner();
+    ion_main_inner(printStackUsage);
   } else {
     // There has been a memory allocation problem
 #if POINCARE_TREE_LOG